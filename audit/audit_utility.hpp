@@ -0,0 +1,84 @@
+#pragma once
+
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <string_view>
+#include <initializer_list>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace aa::audit {
+
+    struct Layout {
+        std::string_view name;
+        std::size_t      size {};
+        std::size_t      alignment {};
+        std::size_t      payload {}; // The size of the largest alternative.
+
+        // The outcome of the special member `requires` ladders of `Maybe_core` and `Result_core`.
+        bool trivial_copy_constructor {};
+        bool trivial_move_constructor {};
+        bool trivial_copy_assignment {};
+        bool trivial_move_assignment {};
+        bool trivial_destructor {};
+
+        // Bytes that hold neither the payload nor the discriminant. A type that is exactly as
+        // large as its payload stores the discriminant in a niche, otherwise it uses a flag byte.
+        [[nodiscard]] auto waste() const noexcept -> std::size_t
+        {
+            return size == payload ? 0 : size - payload - 1;
+        }
+
+        [[nodiscard]] auto nontrivial_members() const noexcept -> std::size_t
+        {
+            return std::ranges::count(
+                std::initializer_list<bool> {
+                    trivial_copy_constructor,
+                    trivial_move_constructor,
+                    trivial_copy_assignment,
+                    trivial_move_assignment,
+                    trivial_destructor,
+                },
+                false);
+        }
+
+        // The x86-64 System V rule: objects of up to 16 bytes with trivial copy and move
+        // constructors and a trivial destructor are passed and returned in registers.
+        [[nodiscard]] auto register_passable() const noexcept -> bool
+        {
+            return trivial_copy_constructor && trivial_move_constructor && trivial_destructor
+                && size <= 16;
+        }
+    };
+
+    template <class>
+    struct Payload;
+
+    template <class T, class Unwrap_config, class Deref_config, class Sentinel_config>
+    struct Payload<Maybe<T, Unwrap_config, Deref_config, Sentinel_config>> {
+        static constexpr std::size_t size = sizeof(T);
+    };
+
+    template <class T, class E, class U, class D, class Value_config, class Error_config, class A>
+    struct Payload<Result<T, E, U, D, Value_config, Error_config, A>> {
+        static constexpr std::size_t size = std::max(sizeof(T), sizeof(E));
+    };
+
+    template <class M>
+    auto layout_of(std::string_view const name) -> Layout
+    {
+        return Layout {
+            .name                     = name,
+            .size                     = sizeof(M),
+            .alignment                = alignof(M),
+            .payload                  = Payload<M>::size,
+            .trivial_copy_constructor = std::is_trivially_copy_constructible_v<M>,
+            .trivial_move_constructor = std::is_trivially_move_constructible_v<M>,
+            .trivial_copy_assignment  = std::is_trivially_copy_assignable_v<M>,
+            .trivial_move_assignment  = std::is_trivially_move_assignable_v<M>,
+            .trivial_destructor       = std::is_trivially_destructible_v<M>,
+        };
+    }
+
+} // namespace aa::audit
@@ -0,0 +1,87 @@
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <cstdint>
+
+// Functions whose generated code is measured against the codegen baseline. They are kept out of
+// line and compiled with optimizations, so each one shows the code an inlined call site would get.
+
+namespace aa::audit {
+
+    enum class Error_code : int { invalid_input = 1 };
+
+    using Unchecked = Access_config_unchecked;
+    using Assume    = Access_config_assume;
+    using Trap      = Access_config_trap;
+
+    [[gnu::noinline]] auto maybe_unwrap_checked(Maybe<int> const& maybe) -> int
+    {
+        return maybe.unwrap();
+    }
+
+    [[gnu::noinline]] auto maybe_unwrap_unchecked(Maybe<int, Unchecked, Unchecked> const& maybe)
+        -> int
+    {
+        return maybe.unwrap();
+    }
+
+    [[gnu::noinline]] auto maybe_unwrap_assume(Maybe<int, Assume, Assume> const& maybe) -> int
+    {
+        return maybe.unwrap();
+    }
+
+    [[gnu::noinline]] auto maybe_unwrap_trap(Maybe<int, Trap, Trap> const& maybe) -> int
+    {
+        return maybe.unwrap();
+    }
+
+    [[gnu::noinline]] auto maybe_map(Maybe<int> const& maybe) -> Maybe<int>
+    {
+        return maybe.map([](int const value) { return value * 2; });
+    }
+
+    [[gnu::noinline]] auto result_unwrap_checked(Result<int, Error_code> const& result) -> int
+    {
+        return result.unwrap();
+    }
+
+    [[gnu::noinline]] auto result_unwrap_unchecked(
+        Result<int, Error_code, Unchecked, Unchecked> const& result) -> int
+    {
+        return result.unwrap();
+    }
+
+    [[gnu::noinline]] auto result_unwrap_assume(
+        Result<int, Error_code, Assume, Assume> const& result) -> int
+    {
+        return result.unwrap();
+    }
+
+    [[gnu::noinline]] auto result_unwrap_trap(Result<int, Error_code, Trap, Trap> const& result)
+        -> int
+    {
+        return result.unwrap();
+    }
+
+    [[gnu::noinline]] auto result_make_value(int const value) -> Result<int, Error_code>
+    {
+        return value;
+    }
+
+    [[gnu::noinline]] auto result_make_error(Error_code const code) -> Result<int, Error_code>
+    {
+        return Error { code };
+    }
+
+    [[gnu::noinline]] auto result_map(Result<int, Error_code> const& result)
+        -> Result<int, Error_code>
+    {
+        return result.map([](int const value) { return value * 2; });
+    }
+
+    [[gnu::noinline]] auto result_pair_make_value(std::uint64_t const value)
+        -> Result<std::uint64_t, std::uint64_t>
+    {
+        return value;
+    }
+
+} // namespace aa::audit
@@ -0,0 +1,103 @@
+# Compare the metrics in CURRENT against those in BASELINE, and fail if any of them has grown.
+# Each line of either file is `key value`, where a smaller value is better. Lines starting with
+# `#` are comments. If UPDATE is true, BASELINE is overwritten with CURRENT instead, keeping its
+# comments.
+#
+# Metrics that depend on the compiler pass TOOLCHAIN, which BASELINE records in a
+# `# Toolchain: ...` line. Then a baseline recorded with another toolchain is not checked, and
+# one recorded with this toolchain must have every metric, so that the check cannot pass by
+# checking nothing.
+#
+# Usage: cmake -D CURRENT=... -D BASELINE=... [-D TOOLCHAIN=...] [-D UPDATE=ON]
+#            -P compare_baseline.cmake
+
+foreach (variable IN ITEMS CURRENT BASELINE)
+    if (NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} is not set")
+    endif ()
+endforeach ()
+
+# Sets `<prefix>_keys` and `<prefix>_values` to parallel lists, `<prefix>_comments` to the
+# comment lines, and `<prefix>_toolchain` to the recorded toolchain.
+function(read_metrics file prefix)
+    set(toolchain)
+    set(keys)
+    set(values)
+    set(comments)
+    if (EXISTS ${file})
+        file(STRINGS ${file} lines)
+        foreach (line IN LISTS lines)
+            if (line MATCHES "^# Toolchain: (.*)$")
+                set(toolchain "${CMAKE_MATCH_1}")
+            elseif (line MATCHES "^#")
+                string(APPEND comments "${line}\n")
+            elseif (line MATCHES "^(.+) ([0-9]+)$")
+                list(APPEND keys "${CMAKE_MATCH_1}")
+                list(APPEND values "${CMAKE_MATCH_2}")
+            elseif (NOT line STREQUAL "")
+                message(FATAL_ERROR "${file}: malformed line: ${line}")
+            endif ()
+        endforeach ()
+    endif ()
+    set(${prefix}_keys "${keys}" PARENT_SCOPE)
+    set(${prefix}_values "${values}" PARENT_SCOPE)
+    set(${prefix}_comments "${comments}" PARENT_SCOPE)
+    set(${prefix}_toolchain "${toolchain}" PARENT_SCOPE)
+endfunction()
+
+read_metrics(${CURRENT} current)
+read_metrics(${BASELINE} baseline)
+
+if (UPDATE)
+    file(READ ${CURRENT} metrics)
+    if (DEFINED TOOLCHAIN)
+        string(APPEND baseline_comments "# Toolchain: ${TOOLCHAIN}\n")
+    endif ()
+    file(WRITE ${BASELINE} "${baseline_comments}${metrics}")
+    message(STATUS "Updated ${BASELINE}")
+    return()
+endif ()
+
+if (DEFINED TOOLCHAIN)
+    if (NOT baseline_toolchain)
+        message(FATAL_ERROR
+            "${BASELINE} has no recorded toolchain. Record it with ${TOOLCHAIN} by rebuilding "
+            "with AA_STL_AUDIT_UPDATE_BASELINE=ON.")
+    endif ()
+    if (NOT baseline_toolchain STREQUAL TOOLCHAIN)
+        message(WARNING
+            "${BASELINE} was recorded with ${baseline_toolchain}, not ${TOOLCHAIN}, so it is not "
+            "checked.")
+        return()
+    endif ()
+endif ()
+
+set(regressions)
+list(LENGTH current_keys count)
+if (count GREATER 0)
+    math(EXPR last "${count} - 1")
+    foreach (index RANGE ${last})
+        list(GET current_keys ${index} key)
+        list(GET current_values ${index} value)
+        list(FIND baseline_keys "${key}" baseline_index)
+        if (baseline_index EQUAL -1)
+            if (DEFINED TOOLCHAIN)
+                string(APPEND regressions "  ${key}: missing -> ${value}\n")
+            else ()
+                message(STATUS "${key}: ${value} (not in the baseline)")
+            endif ()
+            continue()
+        endif ()
+        list(GET baseline_values ${baseline_index} baseline_value)
+        if (value GREATER baseline_value)
+            string(APPEND regressions "  ${key}: ${baseline_value} -> ${value}\n")
+        elseif (value LESS baseline_value)
+            message(STATUS "${key}: ${baseline_value} -> ${value} (improved, update the baseline)")
+        endif ()
+    endforeach ()
+endif ()
+
+if (regressions)
+    message(FATAL_ERROR "Regressions against ${BASELINE}:\n${regressions}")
+endif ()
+message(STATUS "No regressions against ${BASELINE}")
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <aa/sentinel.hpp>
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <string_view>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "audit_utility.hpp"
+
+// The audited instantiations. Add the types that appear on hot paths here, or point
+// AA_STL_AUDIT_MATRIX at a header of your own that defines `aa::audit::matrix()`.
+
+namespace aa::audit {
+
+    enum class Error_code : int { invalid_input = 1 };
+
+    struct Not_found {};
+
+    using Unchecked = Access_config_unchecked;
+    using Checked   = Access_config_checked;
+
+    inline auto matrix() -> std::vector<Layout>
+    {
+        return {
+            layout_of<Maybe<int>>("Maybe<int>"),
+            layout_of<Maybe<int, Unchecked, Unchecked>>("Maybe<int, unchecked>"),
+            layout_of<Maybe<double>>("Maybe<double>"),
+            layout_of<Maybe<std::uint32_t, Checked, Checked, Sentinel_int<std::uint32_t>>>(
+                "Maybe<uint32_t, Sentinel_int>"),
+            layout_of<Maybe<double, Checked, Checked, Sentinel_nan<double>>>(
+                "Maybe<double, Sentinel_nan>"),
+            layout_of<Maybe<int*, Checked, Checked, Sentinel_null<int*>>>(
+                "Maybe<int*, Sentinel_null>"),
+            layout_of<Maybe<Ref<int>>>("Maybe<Ref<int>>"),
+            layout_of<Maybe<std::string_view>>("Maybe<string_view>"),
+            layout_of<Maybe<
+                std::string_view,
+                Checked,
+                Checked,
+                Sentinel_null_data<std::string_view>>>("Maybe<string_view, Sentinel_null_data>"),
+            layout_of<Maybe<std::string>>("Maybe<string>"),
+            layout_of<Maybe<std::unique_ptr<int>>>("Maybe<unique_ptr<int>>"),
+            layout_of<Maybe<
+                std::unique_ptr<int>,
+                Checked,
+                Checked,
+                Sentinel_null<std::unique_ptr<int>>>>("Maybe<unique_ptr<int>, Sentinel_null>"),
+
+            layout_of<Result<int, int>>("Result<int, int>"),
+            layout_of<Result<int, Error_code>>("Result<int, Error_code>"),
+            layout_of<Result<int, Error_code, Unchecked, Unchecked>>(
+                "Result<int, Error_code, unchecked>"),
+            layout_of<Result<double, Error_code>>("Result<double, Error_code>"),
+            layout_of<Result<std::uint64_t, std::uint64_t>>("Result<uint64_t, uint64_t>"),
+            layout_of<Result<Ref<int>, Not_found>>("Result<Ref<int>, Not_found>"),
+            layout_of<Result<std::string_view, Error_code>>("Result<string_view, Error_code>"),
+            layout_of<Result<std::string, int>>("Result<string, int>"),
+        };
+    }
+
+} // namespace aa::audit
@@ -0,0 +1,56 @@
+#include <cstdio>
+#include "audit_utility.hpp"
+
+#if defined(AA_STL_AUDIT_MATRIX)
+#include AA_STL_AUDIT_MATRIX
+#else
+#include "layout_matrix.hpp"
+#endif
+
+// Print the layout of every audited instantiation, and write the metrics to compare against the
+// baseline to the file named by the first argument. Every metric is better when smaller.
+auto main(int const argc, char const* const* const argv) -> int
+{
+    if (argc != 2) {
+        std::fprintf(stderr, "Usage: %s METRICS_FILE\n", argv[0]);
+        return 1;
+    }
+    std::FILE* const metrics = std::fopen(argv[1], "w");
+    if (metrics == nullptr) {
+        std::perror(argv[1]);
+        return 1;
+    }
+
+    std::printf(
+        "%-48s %5s %5s %5s %10s %9s\n", "type", "size", "align", "waste", "nontrivial", "registers");
+    for (aa::audit::Layout const& layout : aa::audit::matrix()) {
+        auto const name = static_cast<int>(layout.name.size());
+        std::printf(
+            "%-48.*s %5zu %5zu %5zu %10zu %9s\n",
+            name,
+            layout.name.data(),
+            layout.size,
+            layout.alignment,
+            layout.waste(),
+            layout.nontrivial_members(),
+            layout.register_passable() ? "yes" : "no");
+
+        std::fprintf(metrics, "%.*s.size %zu\n", name, layout.name.data(), layout.size);
+        std::fprintf(metrics, "%.*s.alignment %zu\n", name, layout.name.data(), layout.alignment);
+        std::fprintf(metrics, "%.*s.waste %zu\n", name, layout.name.data(), layout.waste());
+        std::fprintf(
+            metrics,
+            "%.*s.nontrivial_members %zu\n",
+            name,
+            layout.name.data(),
+            layout.nontrivial_members());
+        std::fprintf(
+            metrics,
+            "%.*s.passed_in_memory %d\n",
+            name,
+            layout.name.data(),
+            layout.register_passable() ? 0 : 1);
+    }
+
+    return std::fclose(metrics) == 0 ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+# Measure every function of namespace `aa::audit` in the object file OBJECT, and write
+# `function.instructions N` and `function.bytes N` lines to OUTPUT. Whether results are returned in
+# registers is not measured here: the tests assert `register_passable`, and the layout audit
+# reports `passed_in_memory`.
+#
+# Usage: cmake -D OBJECT=... -D OBJDUMP=... -D NM=... -D OUTPUT=... -P measure_codegen.cmake
+
+foreach (variable IN ITEMS OBJECT OBJDUMP NM OUTPUT)
+    if (NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} is not set")
+    endif ()
+endforeach ()
+
+# Semicolons and brackets would be taken for list syntax, and are not needed for counting.
+function(read_lines output)
+    execute_process(
+        COMMAND ${ARGN}
+        OUTPUT_VARIABLE text
+        RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Command failed: ${ARGN}")
+    endif ()
+    string(REGEX REPLACE "[];[]" "" text "${text}")
+    string(REPLACE "\n" ";" lines "${text}")
+    set(${output} "${lines}" PARENT_SCOPE)
+endfunction()
+
+read_lines(disassembly ${OBJDUMP} --disassemble --demangle --no-show-raw-insn ${OBJECT})
+
+set(functions)
+set(function)
+foreach (line IN LISTS disassembly)
+    if (line MATCHES "^[0-9a-f]+ <aa::audit::([A-Za-z0-9_]+)\\(")
+        # Cold clones split off by the optimizer are counted with their function.
+        set(function ${CMAKE_MATCH_1})
+        if (NOT DEFINED instructions_${function})
+            set(instructions_${function} 0)
+            set(bytes_${function} 0)
+            list(APPEND functions ${function})
+        endif ()
+    elseif (line MATCHES "^[0-9a-f]+ <")
+        set(function)
+    elseif (function AND line MATCHES "^ *[0-9a-f]+:\t")
+        math(EXPR instructions_${function} "${instructions_${function}} + 1")
+    endif ()
+endforeach ()
+
+read_lines(symbols ${NM} --demangle --print-size --defined-only ${OBJECT})
+
+foreach (line IN LISTS symbols)
+    if (line MATCHES "^[0-9a-f]+ ([0-9a-f]+) [TtWw] aa::audit::([A-Za-z0-9_]+)\\(")
+        if (DEFINED bytes_${CMAKE_MATCH_2})
+            math(EXPR bytes_${CMAKE_MATCH_2} "${bytes_${CMAKE_MATCH_2}} + 0x${CMAKE_MATCH_1}")
+        endif ()
+    endif ()
+endforeach ()
+
+if (NOT functions)
+    message(FATAL_ERROR "No functions of namespace aa::audit found in ${OBJECT}")
+endif ()
+
+list(SORT functions)
+set(metrics)
+foreach (function IN LISTS functions)
+    string(APPEND metrics "${function}.instructions ${instructions_${function}}\n")
+    string(APPEND metrics "${function}.bytes ${bytes_${function}}\n")
+endforeach ()
+file(WRITE ${OUTPUT} "${metrics}")
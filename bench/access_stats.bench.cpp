@@ -0,0 +1,49 @@
+#include <aa/access_stats.hpp>
+#include <aa/maybe.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bench_utility.hpp"
+
+// Measures the overhead of counting accesses per call site, with every thread accessing at once.
+
+namespace {
+
+    constexpr std::size_t size         = std::size_t { 1 } << 16;
+    constexpr std::size_t thread_count = 16;
+
+    using Checked = aa::Maybe<int, aa::Access_config_checked, aa::Access_config_checked>;
+    using Counted = aa::Maybe<int, aa::Access_config_counted, aa::Access_config_counted>;
+
+    // Each thread unwraps every element from two call sites. Thread creation is included, but is
+    // small next to the accesses.
+    template <class M>
+    auto run_threads(aa::bench::Runner& runner, std::string name) -> void
+    {
+        std::vector<M> maybes(size);
+        for (std::size_t index = 0; index != size; ++index) {
+            maybes[index] = M(static_cast<int>(index));
+        }
+        runner.run(std::move(name), thread_count * size * 2, [&] {
+            std::vector<std::jthread> threads;
+            threads.reserve(thread_count);
+            for (std::size_t thread = 0; thread != thread_count; ++thread) {
+                threads.emplace_back([&] {
+                    long sum {};
+                    for (M const& maybe : maybes) {
+                        sum += maybe.unwrap();
+                        sum ^= maybe.unwrap();
+                    }
+                    aa::bench::do_not_optimize(sum);
+                });
+            }
+        });
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(access_stats)
+{
+    run_threads<Checked>(runner, "unwrap_checked_16_threads");
+    run_threads<Counted>(runner, "unwrap_counted_16_threads");
+}
@@ -0,0 +1,68 @@
+#include <aa/arena.hpp>
+#include <aa/result.hpp>
+#include <memory_resource>
+#include <string>
+#include <vector>
+#include "bench_utility.hpp"
+
+// Compares a request's worth of `Result` values whose payloads allocate individually from the
+// heap, against the same values with payloads in an arena, which is released at once by `reset`.
+
+namespace {
+
+    constexpr std::size_t size = std::size_t { 1 } << 12;
+
+    // Long enough to not fit in the small string buffer, so that it allocates.
+    constexpr std::size_t string_length = 48;
+
+    enum class Error_code : int { invalid_input = 1 };
+
+    // Every eighth result is an error.
+    auto run_heap(aa::bench::Runner& runner, std::string name) -> void
+    {
+        runner.run(std::move(name), size, [] {
+            std::vector<aa::Result<std::string, Error_code>> results;
+            results.reserve(size);
+            for (std::size_t index = 0; index != size; ++index) {
+                if (index % 8 == 0) {
+                    results.emplace_back(aa::in_place_error, Error_code::invalid_input);
+                }
+                else {
+                    results.emplace_back(aa::in_place, string_length, 'a');
+                }
+            }
+            aa::bench::do_not_optimize(results.data());
+        });
+    }
+
+    auto run_arena(aa::bench::Runner& runner, std::string name) -> void
+    {
+        using Payload = std::pmr::string;
+        using Results = std::pmr::vector<aa::Result<aa::Arena_ref<Payload>, Error_code>>;
+
+        aa::Arena arena;
+        runner.run(std::move(name), size, [&] {
+            // The vector lives in the arena as well, so nothing is destroyed one by one.
+            auto const results = arena.create<Results>(&arena.resource());
+            results->reserve(size);
+            for (std::size_t index = 0; index != size; ++index) {
+                if (index % 8 == 0) {
+                    results->emplace_back(aa::in_place_error, Error_code::invalid_input);
+                }
+                else {
+                    results->emplace_back(
+                        arena.create<Payload>(string_length, 'a', &arena.resource()));
+                }
+            }
+            aa::bench::do_not_optimize(results->data());
+            arena.reset();
+        });
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(arena)
+{
+    run_heap(runner, "request_heap");
+    run_arena(runner, "request_arena");
+}
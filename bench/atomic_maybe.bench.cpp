@@ -0,0 +1,109 @@
+#include <aa/atomic_maybe.hpp>
+#include <aa/sentinel.hpp>
+#include <aa/maybe.hpp>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <latch>
+#include <mutex>
+#include "bench_utility.hpp"
+
+// Measures the throughput of a slot that every thread publishes to and takes from at once, with
+// `Atomic_maybe` against a `Maybe` guarded by a mutex, which is what the pipelines used before.
+
+namespace {
+
+    constexpr std::size_t operations_per_thread = std::size_t { 1 } << 14;
+
+    using Value = std::uint64_t;
+
+    using Sentinel_config = aa::Sentinel_int<Value>;
+
+    struct alignas(64) Atomic_slot {
+        aa::Atomic_maybe<Value, Sentinel_config> slot;
+
+        auto publish(Value const value) noexcept -> bool
+        {
+            return slot.try_publish(value);
+        }
+
+        auto take() noexcept -> Value
+        {
+            auto const taken = slot.take();
+            return taken.has_value() ? taken.unwrap_unchecked() : 0;
+        }
+    };
+
+    struct alignas(64) Locked_slot {
+        std::mutex mutex;
+        aa::Maybe<Value, aa::Access_config_checked, aa::Access_config_checked, Sentinel_config>
+            slot;
+
+        auto publish(Value const value) -> bool
+        {
+            std::scoped_lock const lock { mutex };
+            if (slot.has_value()) {
+                return false;
+            }
+            slot.emplace(value);
+            return true;
+        }
+
+        auto take() -> Value
+        {
+            std::scoped_lock const lock { mutex };
+            Value const taken = slot.has_value() ? slot.unwrap_unchecked() : 0;
+            slot.reset();
+            return taken;
+        }
+    };
+
+    // Every thread alternates between publishing to and taking from the same slot. Each call
+    // starts its threads, which wait for each other so that they all contend from the start.
+    template <class Slot>
+    auto contend(std::size_t const threads) -> Value
+    {
+        Slot                      slot;
+        std::latch                start { static_cast<std::ptrdiff_t>(threads) };
+        std::vector<Value>        sums(threads);
+        std::vector<std::jthread> workers;
+        workers.reserve(threads);
+        for (std::size_t thread = 0; thread != threads; ++thread) {
+            workers.emplace_back([&, thread] {
+                start.arrive_and_wait();
+                Value sum = 0;
+                for (std::size_t operation = 0; operation != operations_per_thread; ++operation) {
+                    (void)slot.publish(operation);
+                    sum += slot.take();
+                }
+                sums[thread] = sum;
+            });
+        }
+        workers.clear();
+        Value total = 0;
+        for (Value const sum : sums) {
+            total += sum;
+        }
+        return total;
+    }
+
+    template <class Slot>
+    auto run_contention(aa::bench::Runner& runner, std::string const& name) -> void
+    {
+        for (std::size_t const threads : { 1, 2, 4, 8, 16, 32, 64 }) {
+            runner
+                .run(name, threads * operations_per_thread, [&] {
+                    aa::bench::do_not_optimize(contend<Slot>(threads));
+                })
+                .counter("threads", static_cast<double>(threads));
+        }
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(atomic_maybe)
+{
+    run_contention<Atomic_slot>(runner, "atomic_maybe_publish_take");
+    run_contention<Locked_slot>(runner, "mutex_maybe_publish_take");
+}
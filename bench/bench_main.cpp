@@ -0,0 +1,114 @@
+#include <string_view>
+#include <cstdio>
+#include <span>
+#include "bench_utility.hpp"
+
+namespace {
+
+    enum class Format { csv, json };
+
+    auto print_usage(char const* const program) -> void
+    {
+        std::fprintf(stderr, "Usage: %s [--format=csv|json] [--filter=SUBSTRING]\n", program);
+    }
+
+    auto print_json_string(std::string_view const string) -> void
+    {
+        std::putchar('"');
+        for (char const character : string) {
+            if (character == '"' || character == '\\') {
+                std::putchar('\\');
+            }
+            std::putchar(character);
+        }
+        std::putchar('"');
+    }
+
+    // One metric per row, so that rows keep the same shape regardless of counters.
+    auto print_csv(std::vector<aa::bench::Sample> const& samples) -> void
+    {
+        std::puts("suite,benchmark,metric,value");
+        for (aa::bench::Sample const& sample : samples) {
+            std::printf(
+                "%s,%s,ns_per_item,%.4f\n",
+                sample.suite.c_str(),
+                sample.name.c_str(),
+                sample.nanoseconds_per_item);
+            for (aa::bench::Counter const& counter : sample.counters) {
+                std::printf(
+                    "%s,%s,%s,%.4f\n",
+                    sample.suite.c_str(),
+                    sample.name.c_str(),
+                    counter.name.c_str(),
+                    counter.value);
+            }
+        }
+    }
+
+    auto print_json(std::vector<aa::bench::Sample> const& samples) -> void
+    {
+        std::puts("{\"benchmarks\":[");
+        for (std::size_t index = 0; index != samples.size(); ++index) {
+            aa::bench::Sample const& sample = samples[index];
+            std::fputs("{\"suite\":", stdout);
+            print_json_string(sample.suite);
+            std::fputs(",\"name\":", stdout);
+            print_json_string(sample.name);
+            std::printf(",\"ns_per_item\":%.4f,\"counters\":{", sample.nanoseconds_per_item);
+            for (std::size_t counter = 0; counter != sample.counters.size(); ++counter) {
+                if (counter != 0) {
+                    std::putchar(',');
+                }
+                print_json_string(sample.counters[counter].name);
+                std::printf(":%.4f", sample.counters[counter].value);
+            }
+            std::puts(index + 1 == samples.size() ? "}}" : "}},");
+        }
+        std::puts("]}");
+    }
+
+} // namespace
+
+auto aa::bench::suites() -> std::vector<Suite>&
+{
+    static std::vector<Suite> suites;
+    return suites;
+}
+
+// Runs every registered suite whose name contains the filter, and writes the results to stdout.
+auto main(int const argc, char const* const* const argv) -> int
+{
+    Format           format = Format::csv;
+    std::string_view filter;
+
+    for (std::string_view const argument : std::span(argv, static_cast<std::size_t>(argc)).subspan(1)) {
+        if (argument == "--format=csv") {
+            format = Format::csv;
+        }
+        else if (argument == "--format=json") {
+            format = Format::json;
+        }
+        else if (argument.starts_with("--filter=")) {
+            filter = argument.substr(std::string_view("--filter=").size());
+        }
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    aa::bench::Runner runner;
+    for (aa::bench::Suite const& suite : aa::bench::suites()) {
+        if (suite.name.contains(filter)) {
+            runner.begin_suite(std::string(suite.name));
+            suite.function(runner);
+        }
+    }
+
+    if (format == Format::json) {
+        print_json(runner.samples());
+    }
+    else {
+        print_csv(runner.samples());
+    }
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <functional>
+#include <string_view>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#define BENCHMARK_SUITE(name)                                                           \
+    static auto name(::aa::bench::Runner& runner) -> void;                             \
+    static ::aa::bench::Suite_registration const name##_registration { #name, name }; \
+    static auto name(::aa::bench::Runner& runner) -> void
+
+// Keep a function out of line, so that calls to it are measured as calls.
+#if defined(__GNUC__) || defined(__clang__)
+#define BENCHMARK_NOINLINE [[gnu::noinline]]
+#elif defined(_MSC_VER)
+#define BENCHMARK_NOINLINE __declspec(noinline)
+#else
+#define BENCHMARK_NOINLINE
+#endif
+
+namespace aa::bench {
+
+    // Prevent the optimizer from discarding the computation of `value`.
+    template <class T>
+    auto do_not_optimize(T const& value) -> void
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static_cast<void>(*static_cast<char const volatile*>(static_cast<void const*>(&value)));
+#endif
+    }
+
+    struct Counter {
+        std::string name;
+        double      value {};
+    };
+
+    struct Sample {
+        std::string          suite;
+        std::string          name;
+        double               nanoseconds_per_item {};
+        std::vector<Counter> counters;
+
+        auto counter(std::string name, double const value) -> Sample&
+        {
+            counters.push_back(Counter { std::move(name), value });
+            return *this;
+        }
+    };
+
+    class Runner {
+        std::vector<Sample>      m_samples;
+        std::string              m_suite;
+        std::chrono::nanoseconds m_min_time = std::chrono::milliseconds { 100 };
+    public:
+        auto begin_suite(std::string suite) -> void
+        {
+            m_suite = std::move(suite);
+        }
+
+        // Time `function`, which processes `items` items per call, doubling the number of calls
+        // until at least the minimum measurement time has elapsed. The returned sample is only
+        // valid until the next call to `run`.
+        template <std::invocable Function>
+        auto run(std::string name, std::size_t const items, Function&& function) -> Sample&
+        {
+            using Clock = std::chrono::steady_clock;
+            for (std::size_t calls = 1;; calls *= 2) {
+                auto const start = Clock::now();
+                for (std::size_t call = 0; call != calls; ++call) {
+                    std::invoke(function);
+                }
+                auto const elapsed = Clock::now() - start;
+                if (elapsed >= m_min_time) {
+                    double const nanoseconds
+                        = std::chrono::duration<double, std::nano>(elapsed).count();
+                    return m_samples.emplace_back(Sample {
+                        .suite                = m_suite,
+                        .name                 = std::move(name),
+                        .nanoseconds_per_item = nanoseconds / static_cast<double>(calls * items),
+                        .counters             = {},
+                    });
+                }
+            }
+        }
+
+        [[nodiscard]] auto samples() const noexcept -> std::vector<Sample> const&
+        {
+            return m_samples;
+        }
+    };
+
+    using Suite_function = auto (*)(Runner&) -> void;
+
+    struct Suite {
+        std::string_view name;
+        Suite_function   function {};
+    };
+
+    // All registered suites, in registration order.
+    auto suites() -> std::vector<Suite>&;
+
+    struct Suite_registration {
+        Suite_registration(std::string_view const name, Suite_function const function)
+        {
+            suites().push_back(Suite { name, function });
+        }
+    };
+
+} // namespace aa::bench
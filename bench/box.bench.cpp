@@ -0,0 +1,99 @@
+#include <aa/box.hpp>
+#include <aa/result.hpp>
+#include <array>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench_utility.hpp"
+
+// Compares a `Result` with a large error stored inline against the same error in a `Box`, and
+// allocation through `Box` against `std::unique_ptr`.
+
+namespace {
+
+    constexpr std::size_t size = std::size_t { 1 } << 16;
+
+    struct Big_error {
+        std::array<char, 256> message {};
+    };
+
+    using Inline = aa::Result<int, Big_error>;
+    using Boxed  = aa::Result<int, aa::Box<Big_error>>;
+
+    // One percent of the inputs are invalid, placed at random.
+    auto make_inputs() -> std::vector<int>
+    {
+        std::mt19937                engine { 42 };
+        std::bernoulli_distribution invalid { 0.01 };
+        std::vector<int>            inputs(size);
+        for (std::size_t index = 0; index != size; ++index) {
+            int const value = static_cast<int>(index % 1024);
+            inputs[index]   = invalid(engine) ? -value - 1 : value;
+        }
+        return inputs;
+    }
+
+    BENCHMARK_NOINLINE auto parse_inline(int const input) -> Inline
+    {
+        if (input < 0) {
+            return Inline { aa::in_place_error };
+        }
+        return input;
+    }
+
+    BENCHMARK_NOINLINE auto parse_boxed(int const input) -> Boxed
+    {
+        if (input < 0) {
+            return Boxed { aa::in_place_error, aa::in_place };
+        }
+        return input;
+    }
+
+    template <class R, class Parse>
+    auto run_parse(aa::bench::Runner& runner, std::string name, Parse const parse) -> void
+    {
+        std::vector<int> const inputs = make_inputs();
+        runner
+            .run(std::move(name), size, [&] {
+                long sum {};
+                for (int const input : inputs) {
+                    R const result = parse(input);
+                    sum += result.has_value() ? result.unwrap_unchecked() : -1;
+                }
+                aa::bench::do_not_optimize(sum);
+            })
+            .counter("bytes", sizeof(R));
+    }
+
+    // Allocate a batch and release it in reverse order, as a request would.
+    template <class Pointer, class Make>
+    auto run_allocate(aa::bench::Runner& runner, std::string name, Make const make) -> void
+    {
+        std::vector<Pointer> pointers;
+        pointers.reserve(size);
+        runner.run(std::move(name), size, [&] {
+            for (std::size_t index = 0; index != size; ++index) {
+                pointers.push_back(make());
+            }
+            aa::bench::do_not_optimize(pointers.data());
+            while (!pointers.empty()) {
+                pointers.pop_back();
+            }
+        });
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(box)
+{
+    run_parse<Inline>(runner, "parse_inline_error", parse_inline);
+    run_parse<Boxed>(runner, "parse_boxed_error", parse_boxed);
+
+    run_allocate<aa::Box<Big_error>>(runner, "allocate_box", [] {
+        return aa::Box<Big_error> { aa::in_place };
+    });
+    run_allocate<std::unique_ptr<Big_error>>(runner, "allocate_unique_ptr", [] {
+        return std::make_unique<Big_error>();
+    });
+}
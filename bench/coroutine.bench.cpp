@@ -0,0 +1,141 @@
+#include <aa/coroutine.hpp>
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <stdexcept>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench_utility.hpp"
+
+// Compares error propagation with `co_await` against hand-written early returns, on the same
+// three-level call chain as the propagation benchmark of `Result`. The coroutines are not kept
+// from being inlined, so that the compiler can elide their frames.
+
+namespace {
+
+    constexpr std::size_t size = std::size_t { 1 } << 16;
+
+    enum class Error_code : int { invalid_input = 1 };
+
+    using Checked = aa::Result<int, Error_code>;
+
+    // Negative inputs are invalid. They are placed at random, so that the branch predictor cannot
+    // learn the pattern.
+    auto make_inputs(int const error_percent) -> std::vector<int>
+    {
+        std::mt19937                engine { 42 };
+        std::bernoulli_distribution invalid { error_percent / 100.0 };
+        std::vector<int>            inputs(size);
+        for (std::size_t index = 0; index != size; ++index) {
+            int const value = static_cast<int>(index % 1024);
+            inputs[index]   = invalid(engine) ? -value - 1 : value;
+        }
+        return inputs;
+    }
+
+    BENCHMARK_NOINLINE auto parse(int const input) -> Checked
+    {
+        if (input < 0) {
+            return aa::Error { Error_code::invalid_input };
+        }
+        return input;
+    }
+
+    BENCHMARK_NOINLINE auto parse_maybe(int const input) -> aa::Maybe<int>
+    {
+        if (input < 0) {
+            return aa::nothing;
+        }
+        return input;
+    }
+
+    auto manual_scale(int const input) -> Checked
+    {
+        Checked parsed = parse(input);
+        if (parsed.is_error()) {
+            return parsed;
+        }
+        return parsed.unwrap_unchecked() * 2;
+    }
+
+    auto manual_total(int const input) -> Checked
+    {
+        Checked scaled = manual_scale(input);
+        if (scaled.is_error()) {
+            return scaled;
+        }
+        return scaled.unwrap_unchecked() + 1;
+    }
+
+    auto coroutine_scale(int const input) -> Checked
+    {
+        co_return co_await parse(input) * 2;
+    }
+
+    auto coroutine_total(int const input) -> Checked
+    {
+        co_return co_await coroutine_scale(input) + 1;
+    }
+
+    auto manual_maybe_total(int const input) -> aa::Maybe<int>
+    {
+        aa::Maybe<int> parsed = parse_maybe(input);
+        if (parsed.is_empty()) {
+            return aa::nothing;
+        }
+        return parsed.unwrap_unchecked() * 2 + 1;
+    }
+
+    auto coroutine_maybe_total(int const input) -> aa::Maybe<int>
+    {
+        co_return co_await parse_maybe(input) * 2 + 1;
+    }
+
+    template <class Total>
+    auto sum(std::vector<int> const& inputs, Total const total) -> long
+    {
+        long sum {};
+        for (int const input : inputs) {
+            auto const result = total(input);
+            sum += result.has_value() ? result.unwrap_unchecked() : -1;
+        }
+        return sum;
+    }
+
+    template <class Total>
+    auto run_total(
+        aa::bench::Runner&      runner,
+        std::string const&      name,
+        std::vector<int> const& inputs,
+        int const               error_percent,
+        Total const             total) -> void
+    {
+        runner.run(name, size, [&] { aa::bench::do_not_optimize(sum(inputs, total)); })
+            .counter("error_percent", error_percent);
+    }
+
+    auto run_propagate(aa::bench::Runner& runner, int const error_percent) -> void
+    {
+        std::vector<int> const inputs = make_inputs(error_percent);
+        std::string const      suffix = "_" + std::to_string(error_percent) + "_percent";
+
+        // Coroutines cannot be evaluated at compile time, so this is where they are checked.
+        if (sum(inputs, manual_total) != sum(inputs, coroutine_total)
+            || sum(inputs, manual_maybe_total) != sum(inputs, coroutine_maybe_total)) {
+            throw std::logic_error("coroutine results differ from early returns");
+        }
+
+        run_total(runner, "result_early_return" + suffix, inputs, error_percent, manual_total);
+        run_total(runner, "result_co_await" + suffix, inputs, error_percent, coroutine_total);
+        run_total(runner, "maybe_early_return" + suffix, inputs, error_percent, manual_maybe_total);
+        run_total(runner, "maybe_co_await" + suffix, inputs, error_percent, coroutine_maybe_total);
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(coroutine)
+{
+    for (int const error_percent : { 0, 10, 50 }) {
+        run_propagate(runner, error_percent);
+    }
+}
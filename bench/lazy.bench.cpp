@@ -0,0 +1,96 @@
+#include <aa/maybe.hpp>
+#include <string>
+#include <vector>
+#include "bench_utility.hpp"
+
+namespace {
+
+    constexpr std::size_t size = std::size_t { 1 } << 16;
+
+    // A string that counts its moves, to show how many each pipeline performs per element.
+    struct Counted {
+        static inline std::size_t moves = 0;
+
+        std::string text;
+
+        explicit Counted(std::string string) : text(std::move(string)) {}
+
+        Counted(Counted const&) = default;
+
+        Counted(Counted&& other) noexcept : text(std::move(other.text))
+        {
+            ++moves;
+        }
+
+        auto operator=(Counted const&) -> Counted& = default;
+
+        auto operator=(Counted&& other) noexcept -> Counted&
+        {
+            text = std::move(other.text);
+            ++moves;
+            return *this;
+        }
+
+        ~Counted() = default;
+    };
+
+    // Short enough that appending three characters stays within the small string buffer.
+    auto make_sources() -> std::vector<aa::Maybe<Counted>>
+    {
+        std::vector<aa::Maybe<Counted>> sources(size);
+        for (std::size_t index = 0; index != size; ++index) {
+            if (index % 8 != 0) {
+                sources[index].emplace(std::string(8, static_cast<char>('a' + (index % 26))));
+            }
+        }
+        return sources;
+    }
+
+    auto step(Counted&& counted) -> Counted
+    {
+        counted.text.push_back('x');
+        return std::move(counted);
+    }
+
+    auto eager_pipeline(aa::Maybe<Counted> maybe) -> aa::Maybe<Counted>
+    {
+        return std::move(maybe).map(step).map(step).map(step);
+    }
+
+    auto lazy_pipeline(aa::Maybe<Counted> maybe) -> aa::Maybe<Counted>
+    {
+        return std::move(maybe).lazy().map(step).map(step).map(step).evaluate();
+    }
+
+    template <class Pipeline>
+    auto run_pipeline(
+        aa::bench::Runner&                     runner,
+        std::string                            name,
+        std::vector<aa::Maybe<Counted>> const& sources,
+        Pipeline const                         pipeline) -> void
+    {
+        auto const pass = [&] {
+            std::size_t length = 0;
+            for (aa::Maybe<Counted> const& source : sources) {
+                aa::Maybe<Counted> const result = pipeline(source);
+                length += result.has_value() ? result.unwrap_unchecked().text.size() : 0;
+            }
+            aa::bench::do_not_optimize(length);
+        };
+
+        Counted::moves = 0;
+        pass();
+        double const moves = static_cast<double>(Counted::moves) / static_cast<double>(size);
+
+        runner.run(std::move(name), size, pass).counter("moves_per_item", moves);
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(lazy)
+{
+    std::vector<aa::Maybe<Counted>> const sources = make_sources();
+
+    run_pipeline(runner, "map_map_map_eager", sources, eager_pipeline);
+    run_pipeline(runner, "map_map_map_lazy", sources, lazy_pipeline);
+}
@@ -0,0 +1,182 @@
+#include <aa/maybe.hpp>
+#include <optional>
+#include <version>
+#include <string>
+#include <vector>
+#include "bench_utility.hpp"
+
+// Compares `aa::Maybe` against `std::optional` on the same workloads.
+
+namespace {
+
+    constexpr std::size_t size = std::size_t { 1 } << 16;
+
+    using Checked   = aa::Maybe<int, aa::Access_config_checked, aa::Access_config_checked>;
+    using Unchecked = aa::Maybe<int, aa::Access_config_unchecked, aa::Access_config_unchecked>;
+    using Assume    = aa::Maybe<int, aa::Access_config_assume, aa::Access_config_assume>;
+    using Trap      = aa::Maybe<int, aa::Access_config_trap, aa::Access_config_trap>;
+
+    // Long enough to not fit in the small string buffer, so copies allocate.
+    auto make_string(std::size_t const index) -> std::string
+    {
+        return std::string(32, static_cast<char>('a' + (index % 26)));
+    }
+
+    // Every eighth element is empty.
+    template <class O, class Make>
+    auto make_optionals(Make const make) -> std::vector<O>
+    {
+        std::vector<O> optionals(size);
+        for (std::size_t index = 0; index != size; ++index) {
+            if (index % 8 != 0) {
+                optionals[index] = O(make(index));
+            }
+        }
+        return optionals;
+    }
+
+    auto make_int(std::size_t const index) -> int
+    {
+        return static_cast<int>(index);
+    }
+
+    template <class O>
+    auto run_construct(aa::bench::Runner& runner, std::string name) -> void
+    {
+        std::vector<O> optionals(size);
+        runner.run(std::move(name), size, [&] {
+            for (std::size_t index = 0; index != size; ++index) {
+                optionals[index] = index % 8 != 0 ? O(static_cast<int>(index)) : O();
+            }
+            aa::bench::do_not_optimize(optionals.data());
+        });
+    }
+
+    template <class O>
+    auto run_copy(aa::bench::Runner& runner, std::string name) -> void
+    {
+        std::vector<O> const source = make_optionals<O>(make_string);
+        runner.run(std::move(name), size, [&] {
+            std::vector<O> copy = source;
+            aa::bench::do_not_optimize(copy.data());
+        });
+    }
+
+    // Each item is moved out and back in, so the source is intact for the next call.
+    template <class O>
+    auto run_move(aa::bench::Runner& runner, std::string name) -> void
+    {
+        std::vector<O> source = make_optionals<O>(make_string);
+        std::vector<O> target(size);
+        runner.run(std::move(name), size, [&] {
+            for (std::size_t index = 0; index != size; ++index) {
+                target[index] = std::move(source[index]);
+                source[index] = std::move(target[index]);
+            }
+            aa::bench::do_not_optimize(source.data());
+        });
+    }
+
+    template <class O, class Map>
+    auto run_map(aa::bench::Runner& runner, std::string name, Map const map) -> void
+    {
+        std::vector<O> const optionals = make_optionals<O>(make_int);
+        runner.run(std::move(name), size, [&] {
+            long sum {};
+            for (O const& optional : optionals) {
+                sum += map(optional);
+            }
+            aa::bench::do_not_optimize(sum);
+        });
+    }
+
+    // Every element has a value, so checked access never fails.
+    template <class O, class Access>
+    auto run_unwrap(aa::bench::Runner& runner, std::string name, Access const access) -> void
+    {
+        std::vector<O> optionals(size);
+        for (std::size_t index = 0; index != size; ++index) {
+            optionals[index] = O(static_cast<int>(index));
+        }
+        runner.run(std::move(name), size, [&] {
+            long sum {};
+            for (O const& optional : optionals) {
+                sum += access(optional);
+            }
+            aa::bench::do_not_optimize(sum);
+        });
+    }
+
+    // A record with many optional fields, all of which are accessed in one loop body. Each access
+    // is a separate check site, so the size of the inlined check shows in the instruction cache.
+    template <class O>
+    struct Record {
+        O a, b, c, d, e, f, g, h;
+    };
+
+    template <class O>
+    auto run_unwrap_sites(aa::bench::Runner& runner, std::string name) -> void
+    {
+        std::vector<Record<O>> records(size / 8);
+        for (std::size_t index = 0; index != records.size(); ++index) {
+            int const value = static_cast<int>(index);
+            records[index]  = { O(value), O(value), O(value), O(value),
+                                O(value), O(value), O(value), O(value) };
+        }
+        runner.run(std::move(name), size, [&] {
+            long sum {};
+            for (Record<O> const& r : records) {
+                sum += r.a.unwrap() + r.b.unwrap() + r.c.unwrap() + r.d.unwrap();
+                sum += r.e.unwrap() ^ r.f.unwrap() ^ r.g.unwrap() ^ r.h.unwrap();
+            }
+            aa::bench::do_not_optimize(sum);
+        });
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(maybe)
+{
+    run_construct<aa::Maybe<int>>(runner, "construct_int_aa");
+    run_construct<std::optional<int>>(runner, "construct_int_std");
+
+    run_copy<aa::Maybe<std::string>>(runner, "copy_string_aa");
+    run_copy<std::optional<std::string>>(runner, "copy_string_std");
+
+    run_move<aa::Maybe<std::string>>(runner, "move_string_aa");
+    run_move<std::optional<std::string>>(runner, "move_string_std");
+
+    run_map<aa::Maybe<int>>(runner, "map_int_aa", [](aa::Maybe<int> const& maybe) {
+        auto const mapped = maybe.map([](int const value) { return value * 2; });
+        return mapped.has_value() ? mapped.unwrap_unchecked() : 0;
+    });
+#if defined(__cpp_lib_optional) && __cpp_lib_optional >= 202110L
+    run_map<std::optional<int>>(runner, "map_int_std", [](std::optional<int> const& optional) {
+        return optional.transform([](int const value) { return value * 2; }).value_or(0);
+    });
+#endif
+
+    run_unwrap<Checked>(runner, "unwrap_checked_aa", [](Checked const& maybe) {
+        return maybe.unwrap();
+    });
+    run_unwrap<Unchecked>(runner, "unwrap_unchecked_aa", [](Unchecked const& maybe) {
+        return maybe.unwrap();
+    });
+    run_unwrap<Assume>(runner, "unwrap_assume_aa", [](Assume const& maybe) {
+        return maybe.unwrap();
+    });
+    run_unwrap<Trap>(runner, "unwrap_trap_aa", [](Trap const& maybe) {
+        return maybe.unwrap();
+    });
+    run_unwrap<std::optional<int>>(runner, "unwrap_checked_std", [](std::optional<int> const& o) {
+        return o.value();
+    });
+    run_unwrap<std::optional<int>>(runner, "unwrap_unchecked_std", [](std::optional<int> const& o) {
+        return *o;
+    });
+
+    run_unwrap_sites<Checked>(runner, "unwrap_sites_checked_aa");
+    run_unwrap_sites<Unchecked>(runner, "unwrap_sites_unchecked_aa");
+    run_unwrap_sites<Assume>(runner, "unwrap_sites_assume_aa");
+    run_unwrap_sites<Trap>(runner, "unwrap_sites_trap_aa");
+}
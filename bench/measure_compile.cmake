@@ -0,0 +1,37 @@
+# Compile SOURCE once for each number of types in SIZES, defining AA_META_BENCH_TYPES, and report
+# the wall time of each compilation. The peak memory is reported as well if GNU time is found.
+#
+# Usage: cmake -D COMPILER=... -D INCLUDE=... -D SOURCE=... -D SIZES=10,100,1000
+#              [-D TIME=/usr/bin/time] -P measure_compile.cmake
+
+foreach (variable IN ITEMS COMPILER INCLUDE SOURCE SIZES)
+    if (NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} is not set")
+    endif ()
+endforeach ()
+
+string(REPLACE "," ";" sizes "${SIZES}")
+set(memory_file ${CMAKE_CURRENT_BINARY_DIR}/measure_compile_memory.txt)
+
+foreach (size IN LISTS sizes)
+    set(command ${COMPILER} -std=c++23 -fsyntax-only -I${INCLUDE}
+        -DAA_META_BENCH_TYPES=${size} ${SOURCE})
+    if (TIME)
+        set(command ${TIME} -f "%M" -o ${memory_file} ${command})
+    endif ()
+
+    string(TIMESTAMP start "%s%f")
+    execute_process(COMMAND ${command} RESULT_VARIABLE result)
+    string(TIMESTAMP end "%s%f")
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Compilation with ${size} types failed")
+    endif ()
+
+    math(EXPR milliseconds "(${end} - ${start}) / 1000")
+    set(report "${size} types: ${milliseconds} ms")
+    if (TIME)
+        file(STRINGS ${memory_file} kilobytes LIMIT_COUNT 1)
+        string(APPEND report ", ${kilobytes} KB peak memory")
+    endif ()
+    message(STATUS "${report}")
+endforeach ()
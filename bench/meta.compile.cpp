@@ -0,0 +1,42 @@
+#include <aa/meta.hpp>
+#include <cstddef>
+#include <utility>
+
+// Instantiates every list algorithm of `aa::meta` over a list of AA_META_BENCH_TYPES types. This
+// file is compiled, not run: measure_compile.cmake reports the time and memory it takes.
+
+#ifndef AA_META_BENCH_TYPES
+#define AA_META_BENCH_TYPES 100
+#endif
+
+namespace {
+
+    using namespace aa::meta;
+
+    constexpr std::size_t size = AA_META_BENCH_TYPES;
+
+    template <std::size_t>
+    struct Type {};
+
+    // Every type appears twice, so that `Unique` has work to do.
+    template <std::size_t... indices>
+    auto make_types(std::index_sequence<indices...>) -> List<Type<indices % (size / 2 + 1)>...>;
+
+    using Types = decltype(make_types(std::make_index_sequence<size> {}));
+    using Last  = Type<(size - 1) % (size / 2 + 1)>;
+
+    template <class>
+    struct Is_even;
+    template <std::size_t index>
+    struct Is_even<Type<index>> : std::bool_constant<index % 2 == 0> {};
+
+    static_assert(Contains<Last, Types>::value);
+    static_assert(Index_of<Last, Types>::value <= size - 1);
+    static_assert(std::is_same_v<typename At<size - 1, Types>::type, Last>);
+    static_assert(std::is_same_v<
+                  typename Concat<Types, List<int>, Types>::type,
+                  typename Concat<Types, List<int>, Types>::type>);
+    static_assert(!std::is_same_v<typename Filter<Is_even, Types>::type, Types>);
+    static_assert(!std::is_same_v<typename Unique<Types>::type, Types>);
+
+} // namespace
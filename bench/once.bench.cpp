@@ -0,0 +1,122 @@
+#include <aa/once.hpp>
+#include <aa/maybe.hpp>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <array>
+#include <latch>
+#include <mutex>
+#include "bench_utility.hpp"
+
+// Measures the cost of an access to a lookup table that is computed on first use, once it has
+// been, and the time until every one of a number of threads that all start by accessing a table
+// that has not been computed yet gets it. Against `std::call_once` with a separate `Maybe`, which
+// is what the tables used before, and against a function-local static.
+
+namespace {
+
+    constexpr std::size_t accesses = std::size_t { 1 } << 16;
+
+    using Table = std::array<std::uint32_t, 256>;
+
+    // A CRC-32 table, which is a typical table that is computed on first use.
+    auto make_table() noexcept -> Table
+    {
+        Table table {};
+        for (std::uint32_t index = 0; index != table.size(); ++index) {
+            std::uint32_t value = index;
+            for (int bit = 0; bit != 8; ++bit) {
+                value = (value & 1U) != 0 ? 0xEDB8'8320U ^ (value >> 1) : value >> 1;
+            }
+            table[index] = value;
+        }
+        return table;
+    }
+
+    struct Once_table {
+        aa::Once<Table> once;
+
+        auto get() -> Table const&
+        {
+            return once.get_or_init(make_table);
+        }
+    };
+
+    struct Call_once_table {
+        std::once_flag   flag;
+        aa::Maybe<Table> table;
+
+        auto get() -> Table const&
+        {
+            std::call_once(flag, [this] { table.emplace(make_table()); });
+            return table.unwrap_unchecked();
+        }
+    };
+
+    struct Static_table {
+        auto get() -> Table const& // NOLINT: could be static, but the others cannot
+        {
+            static Table const table = make_table();
+            return table;
+        }
+    };
+
+    template <class Lookup>
+    auto run_steady_state(aa::bench::Runner& runner, std::string const& name) -> void
+    {
+        Lookup lookup;
+        (void)lookup.get();
+        runner.run(name, accesses, [&] {
+            std::uint32_t crc = 0xFFFF'FFFFU;
+            for (std::size_t access = 0; access != accesses; ++access) {
+                crc = lookup.get()[(crc ^ access) & 0xFFU] ^ (crc >> 8);
+            }
+            aa::bench::do_not_optimize(crc);
+        });
+    }
+
+    // Every thread accesses a table that has not been computed yet at the same time, so all but
+    // one of them wait for the first.
+    template <class Lookup>
+    auto contend(std::size_t const threads) -> std::uint32_t
+    {
+        Lookup                     lookup;
+        std::latch                 start { static_cast<std::ptrdiff_t>(threads) };
+        std::vector<std::uint32_t> entries(threads);
+        std::vector<std::jthread>  workers;
+        workers.reserve(threads);
+        for (std::size_t thread = 0; thread != threads; ++thread) {
+            workers.emplace_back([&, thread] {
+                start.arrive_and_wait();
+                entries[thread] = lookup.get()[thread & 0xFFU];
+            });
+        }
+        workers.clear();
+        std::uint32_t sum = 0;
+        for (std::uint32_t const entry : entries) {
+            sum += entry;
+        }
+        return sum;
+    }
+
+    template <class Lookup>
+    auto run_contention(aa::bench::Runner& runner, std::string const& name) -> void
+    {
+        for (std::size_t const threads : { 1, 4, 16, 64 }) {
+            runner
+                .run(name, threads, [&] { aa::bench::do_not_optimize(contend<Lookup>(threads)); })
+                .counter("threads", static_cast<double>(threads));
+        }
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(once)
+{
+    run_steady_state<Once_table>(runner, "steady_state_once");
+    run_steady_state<Call_once_table>(runner, "steady_state_call_once");
+    run_steady_state<Static_table>(runner, "steady_state_static");
+    run_contention<Once_table>(runner, "init_contention_once");
+    run_contention<Call_once_table>(runner, "init_contention_call_once");
+}
@@ -0,0 +1,122 @@
+#include <aa/parallel.hpp>
+#include <aa/result.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "bench_utility.hpp"
+
+// Measures how `try_transform_reduce` and `try_collect` scale with the number of threads, and how
+// quickly the first error stops the batch, against a serial loop that returns at the first error.
+
+namespace {
+
+    constexpr std::size_t size = std::size_t { 1 } << 20;
+
+    enum class Error_code : int { invalid_input = 1 };
+
+    using Checked = aa::Result<std::uint64_t, Error_code>;
+
+    // Enough work per element that the batch is not limited by memory bandwidth. The inputs are
+    // their own positions, and the one at `invalid_position` is invalid.
+    struct Validate {
+        std::size_t invalid_position = size;
+
+        auto operator()(std::uint64_t const input) const noexcept -> Checked
+        {
+            if (input == invalid_position) {
+                return aa::Error { Error_code::invalid_input };
+            }
+            std::uint64_t hash = input;
+            for (int round = 0; round != 16; ++round) {
+                hash ^= hash >> 29;
+                hash *= 0xBF58476D1CE4E5B9U;
+            }
+            return hash;
+        }
+    };
+
+    auto make_inputs() -> std::vector<std::uint64_t>
+    {
+        std::vector<std::uint64_t> inputs(size);
+        for (std::size_t index = 0; index != size; ++index) {
+            inputs[index] = index;
+        }
+        return inputs;
+    }
+
+    auto plus(std::uint64_t const a, std::uint64_t const b) noexcept -> std::uint64_t
+    {
+        return a + b;
+    }
+
+    // What the batches looked like before: a serial loop with manual early exit.
+    auto serial_reduce(std::vector<std::uint64_t> const& inputs, Validate const& validate)
+        -> aa::Result<std::uint64_t, Error_code>
+    {
+        std::uint64_t sum = 0;
+        for (std::uint64_t const input : inputs) {
+            Checked result = validate(input);
+            if (result.is_error()) {
+                return aa::Error { result.unwrap_err_unchecked() };
+            }
+            sum += result.unwrap_unchecked();
+        }
+        return sum;
+    }
+
+    auto run_scaling(aa::bench::Runner& runner) -> void
+    {
+        std::vector<std::uint64_t> const inputs = make_inputs();
+        Validate const                   validate {};
+
+        runner.run("transform_reduce_serial_loop", size, [&] {
+            aa::bench::do_not_optimize(serial_reduce(inputs, validate));
+        });
+        for (std::size_t const threads : { 1, 2, 4, 8, 16, 32 }) {
+            aa::Parallel_options const options { .thread_count = threads };
+            runner
+                .run("transform_reduce_threads", size, [&] {
+                    aa::bench::do_not_optimize(aa::try_transform_reduce(
+                        inputs, std::uint64_t {}, plus, validate, options));
+                })
+                .counter("threads", static_cast<double>(threads));
+            runner
+                .run("collect_threads", size, [&] {
+                    aa::bench::do_not_optimize(aa::try_collect(inputs, validate, options));
+                })
+                .counter("threads", static_cast<double>(threads));
+        }
+    }
+
+    // The time until the error is returned, per element of the batch. An error at the start
+    // cancels nearly all of the work, and an error near the end cancels almost none of it.
+    auto run_abort(aa::bench::Runner& runner) -> void
+    {
+        std::vector<std::uint64_t> const inputs = make_inputs();
+        aa::Parallel_options const       options {};
+
+        for (std::size_t const percent : { 0, 10, 50, 90, 100 }) {
+            Validate const validate {
+                .invalid_position = percent == 100 ? size - 1 : size * percent / 100,
+            };
+            runner
+                .run("abort_serial_loop", size, [&] {
+                    aa::bench::do_not_optimize(serial_reduce(inputs, validate));
+                })
+                .counter("error_position_percent", static_cast<double>(percent));
+            runner
+                .run("abort_transform_reduce", size, [&] {
+                    aa::bench::do_not_optimize(aa::try_transform_reduce(
+                        inputs, std::uint64_t {}, plus, validate, options));
+                })
+                .counter("error_position_percent", static_cast<double>(percent));
+        }
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(parallel)
+{
+    run_scaling(runner);
+    run_abort(runner);
+}
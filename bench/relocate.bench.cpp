@@ -0,0 +1,128 @@
+#include <aa/maybe.hpp>
+#include <utility>
+#include <memory>
+#include <vector>
+#include "bench_utility.hpp"
+
+// Compares growing and erasing from a `std::vector`, which moves and destroys the elements one by
+// one, against the same operations on a buffer that relocates them with `memcpy` and `memmove`.
+
+namespace {
+
+    constexpr std::size_t size = std::size_t { 1 } << 20;
+
+    // An owning pointer, so moving and destroying it is not trivial, but relocating it is.
+    class Handle {
+        int* m_pointer {};
+    public:
+        explicit Handle(int const value) : m_pointer(new int(value)) {}
+
+        Handle(Handle&& other) noexcept : m_pointer(std::exchange(other.m_pointer, nullptr)) {}
+
+        auto operator=(Handle&& other) noexcept -> Handle&
+        {
+            std::swap(m_pointer, other.m_pointer);
+            return *this;
+        }
+
+        ~Handle()
+        {
+            delete m_pointer;
+        }
+    };
+
+} // namespace
+
+template <>
+struct aa::Trivially_relocatable<Handle> : std::true_type {};
+
+namespace {
+
+    using Element = aa::Maybe<Handle>;
+
+    // The part of a vector that matters here: growth by doubling, and erasure.
+    class Relocating_buffer {
+        std::allocator<Element> m_allocator;
+        Element*                m_data {};
+        std::size_t             m_size {};
+        std::size_t             m_capacity {};
+    public:
+        Relocating_buffer() = default;
+
+        Relocating_buffer(Relocating_buffer const&) = delete;
+
+        ~Relocating_buffer()
+        {
+            std::destroy_n(m_data, m_size);
+            m_allocator.deallocate(m_data, m_capacity);
+        }
+
+        auto push_back(Element&& element) -> void
+        {
+            if (m_size == m_capacity) {
+                std::size_t const capacity = m_capacity == 0 ? 1 : m_capacity * 2;
+                m_data = aa::grow_storage(m_allocator, m_data, m_size, m_capacity, capacity);
+                m_capacity = capacity;
+            }
+            std::construct_at(m_data + m_size, std::move(element));
+            ++m_size;
+        }
+
+        auto erase(std::size_t const index) -> void
+        {
+            std::destroy_at(m_data + index);
+            aa::relocate_n(m_data + index + 1, m_size - index - 1, m_data + index);
+            --m_size;
+        }
+
+        [[nodiscard]] auto data() const noexcept -> Element const*
+        {
+            return m_data;
+        }
+    };
+
+    static_assert(aa::trivially_relocatable<Element>);
+
+    template <class Buffer>
+    auto run_grow(aa::bench::Runner& runner, std::string name) -> void
+    {
+        runner.run(std::move(name), size, [] {
+            Buffer buffer;
+            for (std::size_t index = 0; index != size; ++index) {
+                buffer.push_back(Element(aa::in_place, static_cast<int>(index)));
+            }
+            aa::bench::do_not_optimize(buffer.data());
+        });
+    }
+
+    // Erase from the middle, then append to keep the size, so every call shifts half the elements.
+    template <class Buffer, class Erase>
+    auto run_erase(aa::bench::Runner& runner, std::string name, Erase const erase) -> void
+    {
+        Buffer buffer;
+        for (std::size_t index = 0; index != size; ++index) {
+            buffer.push_back(Element(aa::in_place, static_cast<int>(index)));
+        }
+        runner.run(std::move(name), size / 2, [&] {
+            erase(buffer, size / 2);
+            buffer.push_back(Element(aa::in_place, 0));
+            aa::bench::do_not_optimize(buffer.data());
+        });
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(relocate)
+{
+    run_grow<std::vector<Element>>(runner, "grow_vector");
+    run_grow<Relocating_buffer>(runner, "grow_relocating");
+
+    run_erase<std::vector<Element>>(
+        runner, "erase_vector", [](std::vector<Element>& vector, std::size_t const index) {
+            vector.erase(vector.begin() + static_cast<std::ptrdiff_t>(index));
+        });
+    run_erase<Relocating_buffer>(
+        runner, "erase_relocating", [](Relocating_buffer& buffer, std::size_t const index) {
+            buffer.erase(index);
+        });
+}
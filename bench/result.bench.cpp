@@ -0,0 +1,332 @@
+#include <aa/result.hpp>
+#include <version>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench_utility.hpp"
+
+#if defined(__cpp_lib_expected)
+#include <expected>
+#endif
+
+// Compares `aa::Result` against `std::expected` and against exceptions on the same workloads.
+
+namespace {
+
+    constexpr std::size_t size = std::size_t { 1 } << 16;
+
+    enum class Error_code : int { invalid_input = 1 };
+
+    struct Invalid_input {
+        Error_code code = Error_code::invalid_input;
+    };
+
+    using Checked = aa::Result<int, Error_code, aa::Access_config_checked, aa::Access_config_checked>;
+    using Unchecked
+        = aa::Result<int, Error_code, aa::Access_config_unchecked, aa::Access_config_unchecked>;
+
+    // Negative inputs are invalid. They are placed at random, so that the branch predictor cannot
+    // learn the pattern.
+    auto make_inputs(int const error_percent) -> std::vector<int>
+    {
+        std::mt19937                engine { 42 };
+        std::bernoulli_distribution invalid { error_percent / 100.0 };
+        std::vector<int>            inputs(size);
+        for (std::size_t index = 0; index != size; ++index) {
+            int const value = static_cast<int>(index % 1024);
+            inputs[index]   = invalid(engine) ? -value - 1 : value;
+        }
+        return inputs;
+    }
+
+    // A three-level call chain, each level forwarding the error of the level below.
+
+    BENCHMARK_NOINLINE auto aa_parse(int const input) -> Checked
+    {
+        if (input < 0) {
+            return aa::Error { Error_code::invalid_input };
+        }
+        return input;
+    }
+
+    BENCHMARK_NOINLINE auto aa_scale(int const input) -> Checked
+    {
+        Checked parsed = aa_parse(input);
+        if (parsed.is_error()) {
+            return parsed;
+        }
+        return parsed.unwrap_unchecked() * 2;
+    }
+
+    BENCHMARK_NOINLINE auto aa_total(int const input) -> Checked
+    {
+        Checked scaled = aa_scale(input);
+        if (scaled.is_error()) {
+            return scaled;
+        }
+        return scaled.unwrap_unchecked() + 1;
+    }
+
+#if defined(__cpp_lib_expected)
+    using Expected = std::expected<int, Error_code>;
+
+    BENCHMARK_NOINLINE auto std_parse(int const input) -> Expected
+    {
+        if (input < 0) {
+            return std::unexpected { Error_code::invalid_input };
+        }
+        return input;
+    }
+
+    BENCHMARK_NOINLINE auto std_scale(int const input) -> Expected
+    {
+        Expected parsed = std_parse(input);
+        if (!parsed.has_value()) {
+            return parsed;
+        }
+        return *parsed * 2;
+    }
+
+    BENCHMARK_NOINLINE auto std_total(int const input) -> Expected
+    {
+        Expected scaled = std_scale(input);
+        if (!scaled.has_value()) {
+            return scaled;
+        }
+        return *scaled + 1;
+    }
+#endif
+
+    BENCHMARK_NOINLINE auto throwing_parse(int const input) -> int
+    {
+        if (input < 0) {
+            throw Invalid_input {};
+        }
+        return input;
+    }
+
+    BENCHMARK_NOINLINE auto throwing_scale(int const input) -> int
+    {
+        return throwing_parse(input) * 2;
+    }
+
+    BENCHMARK_NOINLINE auto throwing_total(int const input) -> int
+    {
+        return throwing_scale(input) + 1;
+    }
+
+    auto run_propagate(aa::bench::Runner& runner, int const error_percent) -> void
+    {
+        std::vector<int> const inputs = make_inputs(error_percent);
+        std::string const      suffix = "_" + std::to_string(error_percent) + "_percent";
+
+        runner
+            .run("propagate_aa" + suffix, size, [&] {
+                long sum {};
+                for (int const input : inputs) {
+                    Checked const result = aa_total(input);
+                    sum += result.has_value() ? result.unwrap_unchecked() : -1;
+                }
+                aa::bench::do_not_optimize(sum);
+            })
+            .counter("error_percent", error_percent);
+
+#if defined(__cpp_lib_expected)
+        runner
+            .run("propagate_std" + suffix, size, [&] {
+                long sum {};
+                for (int const input : inputs) {
+                    Expected const result = std_total(input);
+                    sum += result.has_value() ? *result : -1;
+                }
+                aa::bench::do_not_optimize(sum);
+            })
+            .counter("error_percent", error_percent);
+#endif
+
+        runner
+            .run("propagate_exception" + suffix, size, [&] {
+                long sum {};
+                for (int const input : inputs) {
+                    try {
+                        sum += throwing_total(input);
+                    }
+                    catch (Invalid_input const&) {
+                        sum += -1;
+                    }
+                }
+                aa::bench::do_not_optimize(sum);
+            })
+            .counter("error_percent", error_percent);
+    }
+
+    // Long enough to not fit in the small string buffer, so copies allocate.
+    auto make_string(std::size_t const index) -> std::string
+    {
+        return std::string(32, static_cast<char>('a' + (index % 26)));
+    }
+
+    // Every eighth element is an error, made by `make_error`.
+    template <class R, class Make_error>
+    auto make_results(Make_error const make_error) -> std::vector<R>
+    {
+        std::vector<R> results;
+        results.reserve(size);
+        for (std::size_t index = 0; index != size; ++index) {
+            if (index % 8 == 0) {
+                results.push_back(make_error());
+            }
+            else {
+                results.emplace_back(make_string(index));
+            }
+        }
+        return results;
+    }
+
+    template <class R, class Make_error>
+    auto run_copy_move(aa::bench::Runner& runner, std::string const& name, Make_error const error)
+        -> void
+    {
+        std::vector<R> source = make_results<R>(error);
+        runner.run("copy_string_" + name, size, [&] {
+            std::vector<R> copy = source;
+            aa::bench::do_not_optimize(copy.data());
+        });
+
+        // Each item is moved out and back in, so the source is intact for the next call.
+        std::vector<R> target = source;
+        runner.run("move_string_" + name, size, [&] {
+            for (std::size_t index = 0; index != size; ++index) {
+                target[index] = std::move(source[index]);
+                source[index] = std::move(target[index]);
+            }
+            aa::bench::do_not_optimize(source.data());
+        });
+    }
+
+    template <class R, class Make>
+    auto run_construct(aa::bench::Runner& runner, std::string name, Make const make) -> void
+    {
+        std::vector<int> const inputs = make_inputs(50);
+        runner.run(std::move(name), size, [&] {
+            long sum {};
+            for (int const input : inputs) {
+                R const result = make(input);
+                sum += static_cast<long>(result.has_value());
+            }
+            aa::bench::do_not_optimize(sum);
+        });
+    }
+
+    template <class R, class Access>
+    auto run_access(
+        aa::bench::Runner&      runner,
+        std::string             name,
+        std::vector<R> const&   results,
+        Access const            access) -> void
+    {
+        runner.run(std::move(name), results.size(), [&] {
+            long sum {};
+            for (R const& result : results) {
+                sum += access(result);
+            }
+            aa::bench::do_not_optimize(sum);
+        });
+    }
+
+    template <class R>
+    auto make_int_results(int const error_percent) -> std::vector<R>
+    {
+        std::vector<R> results;
+        results.reserve(size);
+        for (int const input : make_inputs(error_percent)) {
+            if (input < 0) {
+                results.push_back(R(aa::in_place_error, Error_code::invalid_input));
+            }
+            else {
+                results.push_back(R(aa::in_place, input));
+            }
+        }
+        return results;
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(result)
+{
+    run_construct<Checked>(runner, "construct_int_aa", [](int const input) {
+        return input < 0 ? Checked(aa::in_place_error, Error_code::invalid_input)
+                         : Checked(aa::in_place, input);
+    });
+
+    using String_result = aa::Result<std::string, Error_code>;
+    run_copy_move<String_result>(runner, "aa", [] {
+        return String_result(aa::in_place_error, Error_code::invalid_input);
+    });
+
+    std::vector<Checked> const   checked   = make_int_results<Checked>(0);
+    std::vector<Unchecked> const unchecked = make_int_results<Unchecked>(0);
+    std::vector<Checked> const   mixed     = make_int_results<Checked>(50);
+
+    run_access(runner, "unwrap_checked_aa", checked, [](Checked const& result) {
+        return result.unwrap();
+    });
+    run_access(runner, "unwrap_unchecked_aa", unchecked, [](Unchecked const& result) {
+        return result.unwrap();
+    });
+    run_access(runner, "map_int_aa", mixed, [](Checked const& result) {
+        Checked const mapped = result.map([](int const value) { return value * 2; });
+        return mapped.has_value() ? mapped.unwrap_unchecked() : 0;
+    });
+    run_access(runner, "map_err_int_aa", mixed, [](Checked const& result) {
+        auto const mapped = result.map_err([](Error_code const code) {
+            return static_cast<int>(code);
+        });
+        return mapped.has_value() ? 0 : mapped.unwrap_err_unchecked();
+    });
+
+#if defined(__cpp_lib_expected)
+    run_construct<Expected>(runner, "construct_int_std", [](int const input) {
+        return input < 0 ? Expected(std::unexpect, Error_code::invalid_input)
+                         : Expected(std::in_place, input);
+    });
+
+    using String_expected = std::expected<std::string, Error_code>;
+    run_copy_move<String_expected>(runner, "std", [] {
+        return String_expected(std::unexpect, Error_code::invalid_input);
+    });
+
+    std::vector<Expected> expected;
+    std::vector<Expected> expected_mixed;
+    for (Checked const& result : checked) {
+        expected.emplace_back(result.unwrap());
+    }
+    for (Checked const& result : mixed) {
+        expected_mixed.push_back(
+            result.has_value() ? Expected(result.unwrap_unchecked())
+                               : Expected(std::unexpect, result.unwrap_err_unchecked()));
+    }
+
+    run_access(runner, "unwrap_checked_std", expected, [](Expected const& result) {
+        return result.value();
+    });
+    run_access(runner, "unwrap_unchecked_std", expected, [](Expected const& result) {
+        return *result;
+    });
+#if __cpp_lib_expected >= 202211L
+    run_access(runner, "map_int_std", expected_mixed, [](Expected const& result) {
+        return result.transform([](int const value) { return value * 2; }).value_or(0);
+    });
+    run_access(runner, "map_err_int_std", expected_mixed, [](Expected const& result) {
+        auto const mapped = result.transform_error([](Error_code const code) {
+            return static_cast<int>(code);
+        });
+        return mapped.has_value() ? 0 : mapped.error();
+    });
+#endif
+#endif
+
+    for (int const error_percent : { 0, 1, 50 }) {
+        run_propagate(runner, error_percent);
+    }
+}
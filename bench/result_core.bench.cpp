@@ -0,0 +1,75 @@
+#include <aa/result.hpp>
+#include <numeric>
+#include <vector>
+#include "bench_utility.hpp"
+
+namespace {
+
+    struct Not_found {};
+
+    // Opts out of the null sentinel of `Ref`, forcing the flag-based layout for comparison.
+    template <class T>
+    struct No_sentinel final {
+        No_sentinel() = delete;
+        // Not implemented
+        static auto sentinel_value() noexcept -> void;
+        // Not implemented
+        static auto is_sentinel_value(T const&) noexcept -> bool;
+    };
+
+    using Flag_result = aa::Result<
+        aa::Ref<int const>,
+        Not_found,
+        aa::Access_config_checked,
+        aa::Access_config_checked,
+        No_sentinel<aa::Ref<int const>>>;
+
+    using Niche_result = aa::Result<aa::Ref<int const>, Not_found>;
+
+    static_assert(sizeof(Flag_result) == 2 * sizeof(int*));
+    static_assert(sizeof(Niche_result) == sizeof(int*));
+
+    template <class Result>
+    auto sum_values(std::vector<Result> const& results) -> long
+    {
+        long sum {};
+        for (Result const& result : results) {
+            // With the niche layout, checking for a value and loading it are the same load.
+            if (result.has_value()) {
+                sum += result.unwrap_unchecked().get();
+            }
+        }
+        return sum;
+    }
+
+    template <class Result>
+    auto run_sum(aa::bench::Runner& runner, std::string name, std::vector<int> const& values)
+        -> void
+    {
+        std::vector<Result> results;
+        results.reserve(values.size());
+        for (std::size_t index = 0; index != values.size(); ++index) {
+            if (index % 64 == 0) {
+                results.emplace_back(aa::Error { Not_found {} });
+            }
+            else {
+                results.emplace_back(aa::Ref { values[index] });
+            }
+        }
+        runner
+            .run(std::move(name), results.size(), [&] {
+                aa::bench::do_not_optimize(sum_values(results));
+            })
+            .counter("bytes_per_item", static_cast<double>(sizeof(Result)));
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(result_core)
+{
+    std::vector<int> values(std::size_t { 1 } << 20);
+    std::iota(values.begin(), values.end(), 0);
+
+    run_sum<Flag_result>(runner, "sum_flag_layout", values);
+    run_sum<Niche_result>(runner, "sum_niche_layout", values);
+}
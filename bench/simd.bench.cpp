@@ -0,0 +1,148 @@
+#include <aa/simd.hpp>
+#include <aa/sentinel.hpp>
+#include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "bench_utility.hpp"
+
+namespace {
+
+    using Index = aa::Maybe<
+        std::uint32_t,
+        aa::Access_config_checked,
+        aa::Access_config_checked,
+        aa::Sentinel_int<std::uint32_t>>;
+
+    constexpr std::size_t size = std::size_t { 1 } << 20;
+
+    template <class M>
+    auto random_maybes() -> std::vector<M>
+    {
+        std::mt19937                engine { 42 };
+        std::bernoulli_distribution present { 0.75 };
+        std::vector<M>              maybes(size);
+        for (std::size_t index = 0; index != size; ++index) {
+            if (present(engine)) {
+                maybes[index] = static_cast<std::uint32_t>(index);
+            }
+        }
+        return maybes;
+    }
+
+    template <class M>
+    auto run_count(aa::bench::Runner& runner, std::string const& layout) -> void
+    {
+        std::vector<M> const maybes = random_maybes<M>();
+
+        auto const count_loop = [&] {
+            std::size_t count = 0;
+            for (M const& maybe : maybes) {
+                count += static_cast<std::size_t>(maybe.has_value());
+            }
+            return count;
+        };
+        runner.run("count_present_loop_" + layout, size, [&] {
+            aa::bench::do_not_optimize(count_loop());
+        });
+
+        auto const layout_of = aa::simd::dtl::Traits<std::vector<M> const&>::layout(
+            std::span { maybes });
+
+        for (auto const isa : { aa::simd::dtl::Isa::scalar,
+                                aa::simd::dtl::Isa::sse42,
+                                aa::simd::dtl::Isa::avx2 }) {
+            if (isa > aa::simd::dtl::supported_isa()) {
+                continue;
+            }
+            auto const& kernels = aa::simd::dtl::kernels_for(isa);
+            if (kernels.count_present(layout_of) != count_loop()) {
+                throw std::logic_error("count_present kernel differs from the loop");
+            }
+            runner
+                .run("count_present_kernel_" + layout, size, [&] {
+                    aa::bench::do_not_optimize(kernels.count_present(layout_of));
+                })
+                .counter("isa", static_cast<double>(isa));
+        }
+    }
+
+    template <class M>
+    auto run_compact(aa::bench::Runner& runner, std::string const& layout) -> void
+    {
+        std::vector<M> const       maybes = random_maybes<M>();
+        std::vector<std::uint32_t> output(size);
+
+        auto const compact_loop = [&] {
+            std::size_t written = 0;
+            for (M const& maybe : maybes) {
+                if (maybe.has_value()) {
+                    output[written++] = maybe.unwrap_unchecked();
+                }
+            }
+            return written;
+        };
+
+        std::vector<std::uint32_t> expected(compact_loop());
+        std::copy_n(output.begin(), expected.size(), expected.begin());
+        if (aa::simd::compact_values(maybes, output) != expected.size()
+            || !std::equal(expected.begin(), expected.end(), output.begin())) {
+            throw std::logic_error("compact_values differs from the loop");
+        }
+
+        runner.run("compact_values_loop_" + layout, size, [&] {
+            aa::bench::do_not_optimize(compact_loop());
+        });
+        runner.run("compact_values_simd_" + layout, size, [&] {
+            aa::bench::do_not_optimize(aa::simd::compact_values(maybes, output));
+        });
+    }
+
+    template <class M>
+    auto run_fill(aa::bench::Runner& runner, std::string const& layout) -> void
+    {
+        std::vector<M> const original = random_maybes<M>();
+        std::vector<M>       maybes   = original;
+
+        auto const fill_loop = [&] {
+            for (M& maybe : maybes) {
+                if (!maybe.has_value()) {
+                    maybe.emplace(0U);
+                }
+            }
+        };
+
+        fill_loop();
+        std::vector<M> const expected = maybes;
+        maybes                        = original;
+        aa::simd::fill_missing(maybes, 0U);
+        auto const value = [](M const& maybe) { return maybe.unwrap_unchecked(); };
+        if (!std::ranges::equal(maybes, expected, {}, value, value)) {
+            throw std::logic_error("fill_missing differs from the loop");
+        }
+
+        // Both variants restore the original first, so their times are directly comparable.
+        runner.run("fill_missing_loop_" + layout, size, [&] {
+            maybes = original;
+            fill_loop();
+            aa::bench::do_not_optimize(maybes.data());
+        });
+        runner.run("fill_missing_simd_" + layout, size, [&] {
+            maybes = original;
+            aa::simd::fill_missing(maybes, 0U);
+            aa::bench::do_not_optimize(maybes.data());
+        });
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(simd)
+{
+    run_count<aa::Maybe<std::uint32_t>>(runner, "flagged");
+    run_count<Index>(runner, "sentinel");
+    run_compact<aa::Maybe<std::uint32_t>>(runner, "flagged");
+    run_compact<Index>(runner, "sentinel");
+    run_fill<aa::Maybe<std::uint32_t>>(runner, "flagged");
+    run_fill<Index>(runner, "sentinel");
+}
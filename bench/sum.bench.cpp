@@ -0,0 +1,87 @@
+#include <aa/sum.hpp>
+#include <variant>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench_utility.hpp"
+
+// Compares `visit` on `aa::Sum` against `std::visit` on `std::variant`, with the same
+// alternatives, over active alternatives chosen at random.
+
+namespace {
+
+    constexpr std::size_t size = std::size_t { 1 } << 16;
+
+    template <std::size_t index>
+    struct Alternative {
+        std::uint32_t value {};
+    };
+
+    template <template <class...> class Variant, std::size_t... indices>
+    auto make_variant_type(std::index_sequence<indices...>) -> Variant<Alternative<indices>...>;
+
+    template <template <class...> class Variant, std::size_t count>
+    using Variant_of
+        = decltype(make_variant_type<Variant>(std::make_index_sequence<count> {}));
+
+    template <class Variant, std::size_t count>
+    auto random_variants() -> std::vector<Variant>
+    {
+        std::mt19937                                engine { 42 };
+        std::uniform_int_distribution<std::size_t> choice { 0, count - 1 };
+        std::vector<Variant>                        variants;
+        variants.reserve(size);
+        for (std::size_t index = 0; index != size; ++index) {
+            [&]<std::size_t... indices>(std::index_sequence<indices...>) {
+                std::size_t const chosen = choice(engine);
+                auto const        value  = static_cast<std::uint32_t>(index);
+                static_cast<void>(
+                    ((chosen == indices
+                      && (variants.emplace_back(Alternative<indices> { value }), true))
+                     || ...));
+            }(std::make_index_sequence<count> {});
+        }
+        return variants;
+    }
+
+    // Each alternative does different work, so that the cases cannot be merged.
+    template <std::size_t index>
+    auto work(Alternative<index> const alternative) noexcept -> std::uint32_t
+    {
+        return alternative.value * static_cast<std::uint32_t>(index + 1);
+    }
+
+    template <std::size_t count>
+    auto run_visit(aa::bench::Runner& runner) -> void
+    {
+        auto const visitor = [](auto const& alternative) noexcept { return work(alternative); };
+
+        auto const sums = random_variants<Variant_of<aa::Sum, count>, count>();
+        runner.run("visit_sum_" + std::to_string(count), size, [&] {
+            std::uint32_t total = 0;
+            for (auto const& sum : sums) {
+                total += sum.visit(visitor);
+            }
+            aa::bench::do_not_optimize(total);
+        });
+
+        auto const variants = random_variants<Variant_of<std::variant, count>, count>();
+        runner.run("visit_std_variant_" + std::to_string(count), size, [&] {
+            std::uint32_t total = 0;
+            for (auto const& variant : variants) {
+                total += std::visit(visitor, variant);
+            }
+            aa::bench::do_not_optimize(total);
+        });
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(sum)
+{
+    run_visit<2>(runner);
+    run_visit<4>(runner);
+    run_visit<8>(runner);
+    run_visit<32>(runner);
+}
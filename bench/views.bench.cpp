@@ -0,0 +1,120 @@
+#include <aa/views.hpp>
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <cstdint>
+#include <vector>
+#include "bench_utility.hpp"
+
+// Measures summing the values of a batch of results through the views, against collecting them
+// into a vector first, which is what callers had to do before.
+
+namespace {
+
+    constexpr std::size_t size = std::size_t { 1 } << 16;
+
+    using Checked = aa::Result<std::uint64_t, int>;
+
+    // Every fourth input is invalid.
+    auto check(std::uint64_t const input) noexcept -> Checked
+    {
+        if (input % 4 == 0) {
+            return aa::Error { 1 };
+        }
+        return input * 3;
+    }
+
+    auto maybe_check(std::uint64_t const input) noexcept -> aa::Maybe<std::uint64_t>
+    {
+        if (input % 4 == 0) {
+            return aa::nothing;
+        }
+        return input * 3;
+    }
+
+    auto make_inputs() -> std::vector<std::uint64_t>
+    {
+        std::vector<std::uint64_t> inputs(size);
+        for (std::size_t index = 0; index != size; ++index) {
+            inputs[index] = index;
+        }
+        return inputs;
+    }
+
+    auto make_results(std::vector<std::uint64_t> const& inputs) -> std::vector<Checked>
+    {
+        std::vector<Checked> results;
+        results.reserve(inputs.size());
+        for (std::uint64_t const input : inputs) {
+            results.push_back(check(input));
+        }
+        return results;
+    }
+
+    auto run_stored(aa::bench::Runner& runner) -> void
+    {
+        std::vector<Checked> const results = make_results(make_inputs());
+
+        runner.run("stored_collect_then_sum", size, [&] {
+            std::vector<std::uint64_t> values;
+            for (Checked const& result : results) {
+                if (result.has_value()) {
+                    values.push_back(result.unwrap_unchecked());
+                }
+            }
+            std::uint64_t sum = 0;
+            for (std::uint64_t const value : values) {
+                sum += value;
+            }
+            aa::bench::do_not_optimize(sum);
+        });
+        runner.run("stored_values_view", size, [&] {
+            std::uint64_t sum = 0;
+            for (std::uint64_t const value : results | aa::views::values) {
+                sum += value;
+            }
+            aa::bench::do_not_optimize(sum);
+        });
+    }
+
+    // Results computed on the fly, where `values` computes each kept element twice.
+    auto run_computed(aa::bench::Runner& runner) -> void
+    {
+        std::vector<std::uint64_t> const inputs = make_inputs();
+
+        runner.run("computed_collect_then_sum", size, [&] {
+            std::vector<std::uint64_t> values;
+            for (std::uint64_t const input : inputs) {
+                if (Checked result = check(input); result.has_value()) {
+                    values.push_back(result.unwrap_unchecked());
+                }
+            }
+            std::uint64_t sum = 0;
+            for (std::uint64_t const value : values) {
+                sum += value;
+            }
+            aa::bench::do_not_optimize(sum);
+        });
+        runner.run("computed_values_view", size, [&] {
+            std::uint64_t sum = 0;
+            for (std::uint64_t const value :
+                 inputs | std::views::transform(check) | aa::views::values) {
+                sum += value;
+            }
+            aa::bench::do_not_optimize(sum);
+        });
+        runner.run("computed_filter_map", size, [&] {
+            std::uint64_t sum = 0;
+            for (std::uint64_t const value : inputs | aa::views::filter_map(maybe_check)) {
+                sum += value;
+            }
+            aa::bench::do_not_optimize(sum);
+        });
+    }
+
+} // namespace
+
+BENCHMARK_SUITE(views)
+{
+    run_stored(runner);
+    run_computed(runner);
+}
@@ -0,0 +1,236 @@
+#include <aa/access_stats.hpp>
+#include <algorithm>
+#include <cstring>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace {
+
+    using aa::access_stats::Site;
+
+    // Call sites per thread. Accesses from further call sites are counted in the overflow slot.
+    constexpr std::size_t table_capacity = 512;
+
+    // Slots probed for a call site before it is counted in the overflow slot, so that a full
+    // table does not make every access from a new call site scan all of it.
+    constexpr std::size_t max_probes = 16;
+
+    constexpr auto relaxed = std::memory_order_relaxed;
+
+    // Written only by the owning thread. The location is published by the release store of
+    // `file_name`, after which it never changes, and the counters are atomic so that `snapshot`
+    // can read them while the owner increments them.
+    struct Slot {
+        std::atomic<char const*>   file_name { nullptr };
+        char const*                function_name {};
+        std::uint32_t              line {};
+        std::uint32_t              column {};
+        std::atomic<std::uint64_t> hits { 0 };
+        std::atomic<std::uint64_t> failures { 0 };
+    };
+
+    struct Table {
+        Slot slots[table_capacity]; // NOLINT: C array, the table is not copied
+        Slot overflow;
+    };
+
+    auto is_same_site(Site const& a, Site const& b) noexcept -> bool
+    {
+        return a.line == b.line && a.column == b.column
+            && std::strcmp(a.file_name, b.file_name) == 0;
+    }
+
+    auto is_before(Site const& a, Site const& b) noexcept -> bool
+    {
+        if (int const order = std::strcmp(a.file_name, b.file_name); order != 0) {
+            return order < 0;
+        }
+        return a.line != b.line ? a.line < b.line : a.column < b.column;
+    }
+
+    auto read_slot(Slot const& slot, std::vector<Site>& sites) -> void
+    {
+        char const* const file_name = slot.file_name.load(std::memory_order_acquire);
+        if (file_name != nullptr && slot.hits.load(relaxed) != 0) {
+            sites.push_back(Site {
+                .file_name     = file_name,
+                .function_name = slot.function_name,
+                .line          = slot.line,
+                .column        = slot.column,
+                .hits          = slot.hits.load(relaxed),
+                .failures      = slot.failures.load(relaxed),
+            });
+        }
+    }
+
+    auto read_table(Table const& table, std::vector<Site>& sites) -> void
+    {
+        for (Slot const& slot : table.slots) {
+            read_slot(slot, sites);
+        }
+        read_slot(table.overflow, sites);
+    }
+
+    // Sort the sites and add up the counts of equal ones. The same site may appear once per
+    // thread, and under several file name pointers.
+    auto merge(std::vector<Site>& sites) -> void
+    {
+        std::ranges::sort(sites, is_before);
+        auto output = sites.begin();
+        for (auto input = sites.begin(); input != sites.end(); ++input) {
+            if (output != sites.begin() && is_same_site(output[-1], *input)) {
+                output[-1].hits     += input->hits;
+                output[-1].failures += input->failures;
+            }
+            else {
+                *output++ = *input;
+            }
+        }
+        sites.erase(output, sites.end());
+    }
+
+    // The tables of the running threads, and the merged counts of the threads that have exited.
+    struct Registry {
+        std::mutex          mutex;
+        std::vector<Table*> tables;
+        std::vector<Site>   retired;
+    };
+
+    // Leaked, so that threads that exit during static destruction can still retire their tables.
+    auto registry() -> Registry&
+    {
+        static Registry* const instance = new Registry; // NOLINT: intentionally leaked
+        return *instance;
+    }
+
+    // Set once the table of the current thread has been retired, so that accesses counted later
+    // during thread exit, from the destructors of other thread-locals, go to the registry.
+    thread_local bool table_destroyed = false;
+
+    // Count an access directly in the retired counts. Slow, but only used during thread exit.
+    auto record_retired(std::source_location const& caller, bool const failed) -> void
+    {
+        Site const site {
+            .file_name     = caller.file_name(),
+            .function_name = caller.function_name(),
+            .line          = caller.line(),
+            .column        = caller.column(),
+            .hits          = 1,
+            .failures      = failed ? 1U : 0U,
+        };
+        Registry&             registry = ::registry();
+        std::lock_guard const lock { registry.mutex };
+        auto const            it = std::ranges::find_if(
+            registry.retired, [&](Site const& other) { return is_same_site(other, site); });
+        if (it == registry.retired.end()) {
+            registry.retired.push_back(site);
+        }
+        else {
+            it->hits     += site.hits;
+            it->failures += site.failures;
+        }
+    }
+
+    class Thread_table {
+        std::unique_ptr<Table> m_table = std::make_unique<Table>();
+    public:
+        Thread_table()
+        {
+            m_table->overflow.function_name = "";
+            m_table->overflow.file_name.store("<other call sites>", relaxed);
+
+            Registry&             registry = ::registry();
+            std::lock_guard const lock { registry.mutex };
+            registry.tables.push_back(m_table.get());
+        }
+
+        Thread_table(Thread_table const&)                    = delete;
+        auto operator=(Thread_table const&) -> Thread_table& = delete;
+
+        ~Thread_table()
+        {
+            Registry&             registry = ::registry();
+            std::lock_guard const lock { registry.mutex };
+            std::erase(registry.tables, m_table.get());
+            read_table(*m_table, registry.retired);
+            merge(registry.retired);
+            table_destroyed = true;
+        }
+
+        auto slot(std::source_location const& caller) noexcept -> Slot&
+        {
+            std::uint64_t hash = reinterpret_cast<std::uintptr_t>(caller.file_name()); // NOLINT
+            hash ^= (std::uint64_t { caller.line() } << 16) ^ caller.column();
+            hash *= 0x9E3779B97F4A7C15U;
+            hash ^= hash >> 32;
+
+            for (std::size_t probe = 0; probe != max_probes; ++probe) {
+                Slot&             slot      = m_table->slots[(hash + probe) % table_capacity];
+                char const* const file_name = slot.file_name.load(relaxed);
+                if (file_name == nullptr) {
+                    slot.function_name = caller.function_name();
+                    slot.line          = caller.line();
+                    slot.column        = caller.column();
+                    slot.file_name.store(caller.file_name(), std::memory_order_release);
+                    return slot;
+                }
+                if (file_name == caller.file_name() && slot.line == caller.line()
+                    && slot.column == caller.column())
+                {
+                    return slot;
+                }
+            }
+            return m_table->overflow;
+        }
+    };
+
+    thread_local Thread_table thread_table;
+
+    // Only the owning thread increments, so a load and a store suffice.
+    auto increment(std::atomic<std::uint64_t>& counter) noexcept -> void
+    {
+        counter.store(counter.load(relaxed) + 1, relaxed);
+    }
+
+} // namespace
+
+auto aa::access_stats::dtl::record(std::source_location const caller, bool const failed) -> void
+{
+    if (table_destroyed) {
+        record_retired(caller, failed);
+        return;
+    }
+    Slot& slot = thread_table.slot(caller);
+    increment(slot.hits);
+    if (failed) {
+        increment(slot.failures);
+    }
+}
+
+auto aa::access_stats::snapshot() -> std::vector<Site>
+{
+    Registry&             registry = ::registry();
+    std::lock_guard const lock { registry.mutex };
+    std::vector<Site>     sites = registry.retired;
+    for (Table const* const table : registry.tables) {
+        read_table(*table, sites);
+    }
+    merge(sites);
+    return sites;
+}
+
+auto aa::access_stats::dump(std::FILE* const file) -> void
+{
+    for (Site const& site : snapshot()) {
+        std::fprintf(
+            file,
+            "%s:%u:%u: %s: %llu hits, %llu failures\n",
+            site.file_name,
+            static_cast<unsigned>(site.line),
+            static_cast<unsigned>(site.column),
+            site.function_name,
+            static_cast<unsigned long long>(site.hits),
+            static_cast<unsigned long long>(site.failures));
+    }
+}
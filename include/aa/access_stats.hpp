@@ -0,0 +1,58 @@
+#pragma once
+
+#include <aa/utility.hpp>
+#include <source_location>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace aa::access_stats::dtl {
+
+    // Count one access in the table of the calling thread. Only that thread writes to the table,
+    // so this is a hash lookup and two plain increments, without atomic read-modify-writes.
+    auto record(std::source_location caller, bool failed) -> void;
+
+} // namespace aa::access_stats::dtl
+
+namespace aa::access_stats {
+
+    // The counts of one call site. Accesses through `operator*` and `operator->` cannot take the
+    // location of their caller, so they are counted at the location of the operator.
+    struct Site {
+        char const*   file_name {};
+        char const*   function_name {};
+        std::uint32_t line {};
+        std::uint32_t column {};
+        std::uint64_t hits {};
+        std::uint64_t failures {};
+    };
+
+    // The counts of every thread, including threads that have exited, merged by call site and
+    // sorted by location. Accesses that are counted concurrently may or may not be included.
+    [[nodiscard]] auto snapshot() -> std::vector<Site>;
+
+    // Write the snapshot to `file`, one call site per line.
+    auto dump(std::FILE* file) -> void;
+
+} // namespace aa::access_stats
+
+namespace aa {
+
+    // Counts the accesses and the failed accesses of each call site, for telemetry, and otherwise
+    // behaves like `Access_config_checked`. Accesses in constant evaluation are not counted.
+    struct Access_config_counted final {
+        Access_config_counted() = delete;
+        static constexpr auto validate_access(
+            bool const                 has_value,
+            std::source_location const caller = std::source_location::current()) -> void
+        {
+            if !consteval {
+                access_stats::dtl::record(caller, !has_value);
+            }
+            if (!has_value) {
+                dtl::throw_bad_access(caller);
+            }
+        }
+    };
+
+} // namespace aa
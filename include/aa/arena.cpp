@@ -0,0 +1,64 @@
+#include <aa/arena.hpp>
+#include <algorithm>
+
+aa::Arena::Arena(std::size_t const chunk_size) noexcept : m_chunk_size { chunk_size } {}
+
+aa::Arena::~Arena()
+{
+    for (Chunk* list : { m_used, m_free }) {
+        while (list != nullptr) {
+            ::operator delete(std::exchange(list, list->next));
+        }
+    }
+}
+
+// The current chunk is exhausted. Continue in the first free chunk if it is large enough for any
+// alignment of the allocation, or in a new chunk otherwise.
+auto aa::Arena::allocate_from_new_chunk(std::size_t const size, std::size_t const alignment)
+    -> void*
+{
+    std::size_t const needed = size + alignment;
+
+    Chunk* chunk = m_free;
+    if (chunk != nullptr && chunk->size >= needed) {
+        m_free = chunk->next;
+    }
+    else {
+        std::size_t const chunk_size = std::max(m_chunk_size, needed);
+        chunk = ::new (::operator new(sizeof(Chunk) + chunk_size)) Chunk { nullptr, chunk_size };
+    }
+
+    chunk->next = m_used;
+    m_used      = chunk;
+    if (m_used_last == nullptr) {
+        m_used_last = chunk;
+    }
+    m_cursor = reinterpret_cast<std::byte*>(chunk + 1); // NOLINT: the data follows the header
+    m_end    = m_cursor + chunk->size;
+    return allocate(size, alignment);
+}
+
+auto aa::Arena::reset() noexcept -> void
+{
+    if (m_used != nullptr) {
+        m_used_last->next = m_free;
+        m_free            = std::exchange(m_used, nullptr);
+        m_used_last       = nullptr;
+    }
+    m_cursor = nullptr;
+    m_end    = nullptr;
+}
+
+auto aa::Arena::Resource::do_allocate(std::size_t const size, std::size_t const alignment)
+    -> void*
+{
+    return m_arena->allocate(size, alignment);
+}
+
+auto aa::Arena::Resource::do_deallocate(void*, std::size_t, std::size_t) -> void {}
+
+auto aa::Arena::Resource::do_is_equal(std::pmr::memory_resource const& other) const noexcept
+    -> bool
+{
+    return this == &other;
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <aa/utility.hpp>
+#include <memory_resource>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace aa {
+
+    class Arena;
+
+    // Refers to an object that was created by an `Arena`. It remains valid until the arena is
+    // reset or destroyed. The null sentinel makes `Maybe<Arena_ref<T>>` as large as a pointer.
+    template <class T>
+    class Arena_ref final {
+        T* m_pointer;
+
+        friend class Arena;
+
+        explicit constexpr Arena_ref(T* const pointer) noexcept : m_pointer { pointer } {}
+    public:
+        constexpr Arena_ref(Arena_ref<std::remove_const_t<T>> const other) noexcept
+            requires std::is_const_v<T>
+            : m_pointer { other.operator->() }
+        {}
+
+        [[nodiscard]] constexpr operator T&() const noexcept
+        {
+            return *m_pointer;
+        }
+        [[nodiscard]] constexpr auto operator*() const noexcept -> T&
+        {
+            return *m_pointer;
+        }
+        [[nodiscard]] constexpr auto operator->() const noexcept -> T*
+        {
+            return m_pointer;
+        }
+        [[nodiscard]] constexpr auto get() const noexcept -> T&
+        {
+            return *m_pointer;
+        }
+
+        [[nodiscard]] constexpr auto as_ref() const noexcept -> Ref<T>
+        {
+            return Ref<T> { *m_pointer };
+        }
+
+        // Dangerous escape hatch for special cases, such as sentinel values.
+        [[nodiscard]] static constexpr auto unsafe_construct_null_reference() noexcept -> Arena_ref
+        {
+            return Arena_ref { nullptr };
+        }
+    };
+
+    template <class T>
+    struct Sentinel_config_default_for<Arena_ref<T>> final {
+        Sentinel_config_default_for() = delete;
+        static constexpr bool is_bitwise = true;
+        static constexpr auto sentinel_value() noexcept -> Arena_ref<T>
+        {
+            return Arena_ref<T>::unsafe_construct_null_reference();
+        }
+        static constexpr auto is_sentinel_value(Arena_ref<T> const ref) noexcept -> bool
+        {
+            return ref.operator->() == nullptr;
+        }
+    };
+
+    // A monotonic bump allocator. Memory is only released all at once, by `reset`, which keeps the
+    // chunks for reuse, or by the destructor. Neither runs the destructors of the objects in the
+    // arena, so only objects whose destructors are trivial or merely release memory to the arena,
+    // such as `std::pmr` containers that use `resource()`, should be created in it.
+    class Arena final {
+        struct Chunk {
+            Chunk*      next;
+            std::size_t size;
+        };
+
+        class Resource final : public std::pmr::memory_resource {
+            Arena* m_arena;
+        public:
+            explicit Resource(Arena& arena) noexcept : m_arena { &arena } {}
+        private:
+            auto do_allocate(std::size_t size, std::size_t alignment) -> void* override;
+            auto do_deallocate(void* pointer, std::size_t size, std::size_t alignment)
+                -> void override;
+            [[nodiscard]] auto do_is_equal(std::pmr::memory_resource const& other) const noexcept
+                -> bool override;
+        };
+
+        std::byte*  m_cursor     = nullptr;
+        std::byte*  m_end        = nullptr;
+        Chunk*      m_used       = nullptr; // The current chunk comes first.
+        Chunk*      m_used_last  = nullptr;
+        Chunk*      m_free       = nullptr;
+        std::size_t m_chunk_size = 0;
+        Resource    m_resource { *this };
+
+        auto allocate_from_new_chunk(std::size_t size, std::size_t alignment) -> void*;
+    public:
+        static constexpr std::size_t default_chunk_size = std::size_t { 64 } * 1024;
+
+        explicit Arena(std::size_t chunk_size = default_chunk_size) noexcept;
+
+        // The resource and every `Arena_ref` refer to the arena, so it cannot be copied or moved.
+        Arena(Arena const&)                    = delete;
+        auto operator=(Arena const&) -> Arena& = delete;
+
+        ~Arena();
+
+        // Precondition: `alignment` is a power of two
+        [[nodiscard]] auto allocate(
+            std::size_t const size, std::size_t const alignment = alignof(std::max_align_t))
+            -> void*
+        {
+            if (m_cursor != nullptr) {
+                auto const address = reinterpret_cast<std::uintptr_t>(m_cursor); // NOLINT
+                auto const aligned = (address + alignment - 1) & ~(alignment - 1);
+                if (aligned + size <= reinterpret_cast<std::uintptr_t>(m_end)) { // NOLINT
+                    m_cursor += aligned - address + size;
+                    return m_cursor - size;
+                }
+            }
+            return allocate_from_new_chunk(size, alignment);
+        }
+
+        template <class T, class... Args>
+            requires std::is_constructible_v<T, Args&&...>
+        [[nodiscard]] auto create(Args&&... args) -> Arena_ref<T>
+        {
+            void* const storage = allocate(sizeof(T), alignof(T));
+            return Arena_ref<T> { std::construct_at(
+                static_cast<T*>(storage), std::forward<Args>(args)...) };
+        }
+
+        // Release every allocation at once, keeping the chunks for reuse.
+        auto reset() noexcept -> void;
+
+        // A memory resource that allocates from this arena, for `std::pmr` containers.
+        // Deallocation does nothing.
+        [[nodiscard]] auto resource() noexcept -> std::pmr::memory_resource&
+        {
+            return m_resource;
+        }
+    };
+
+} // namespace aa
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <aa/maybe.hpp>
+#include <aa/utility.hpp>
+#include <utility>
+#include <atomic>
+
+namespace aa {
+
+    // A `Maybe` that can be shared between threads without a lock. Emptiness is encoded by the
+    // sentinel, so the whole state is a single atomic word, and every operation is one atomic
+    // instruction. Requires a bitwise sentinel config, since the atomic compares object
+    // representations, and a `T` that the target can access atomically without a lock.
+    //
+    // Storing and publishing release the value, and loading and taking acquire it, so whatever the
+    // publisher wrote before publishing is visible to whoever loads or takes the value.
+    template <class T, bitwise_sentinel_config<T> Sentinel_config = Sentinel_config_default_for<T>>
+        requires std::atomic_ref<T>::is_always_lock_free
+    class Atomic_maybe final {
+    public:
+        using Value_maybe = Maybe<T, Access_config_checked, Access_config_checked, Sentinel_config>;
+    private:
+        // Accessed directly in constant evaluation, where there is only one thread. Mutable, since
+        // even a lock-free load may write: on x86-64, a 16-byte load is a compare-exchange. This
+        // also keeps a const `Atomic_maybe` out of read-only memory.
+        alignas(std::atomic_ref<T>::required_alignment) mutable T m_value;
+
+        [[nodiscard]] auto atomic() const noexcept -> std::atomic_ref<T>
+        {
+            return std::atomic_ref<T>(m_value);
+        }
+
+        [[nodiscard]] static constexpr auto is_empty_value(T const& value) noexcept -> bool
+        {
+            return Sentinel_config::is_sentinel_value(value);
+        }
+
+        // The object representation of `maybe`, which is the sentinel if it is empty.
+        [[nodiscard]] static constexpr auto raw(Value_maybe maybe) noexcept -> T
+        {
+            return dtl::Maybe_access::core(maybe).m_value;
+        }
+
+        [[nodiscard]] static constexpr auto cooked(T const value) noexcept -> Value_maybe
+        {
+            Value_maybe maybe;
+            dtl::Maybe_access::core(maybe).m_value = value;
+            return maybe;
+        }
+    public:
+        constexpr Atomic_maybe() noexcept : m_value { Sentinel_config::sentinel_value() } {}
+
+        explicit constexpr Atomic_maybe(Value_maybe maybe) noexcept
+            : m_value { raw(maybe) }
+        {}
+
+        Atomic_maybe(Atomic_maybe const&)                    = delete;
+        auto operator=(Atomic_maybe const&) -> Atomic_maybe& = delete;
+
+        // The value at the time of the call, which may be outdated by the time it is returned.
+        [[nodiscard]] constexpr auto load(std::memory_order const order = std::memory_order_acquire)
+            const noexcept -> Value_maybe
+        {
+            if consteval {
+                return cooked(m_value);
+            }
+            return cooked(atomic().load(order));
+        }
+
+        [[nodiscard]] constexpr auto has_value() const noexcept -> bool
+        {
+            return load(std::memory_order_relaxed).has_value();
+        }
+
+        constexpr auto store(
+            Value_maybe maybe, std::memory_order const order = std::memory_order_release) noexcept
+            -> void
+        {
+            if consteval {
+                m_value = raw(maybe);
+                return;
+            }
+            atomic().store(raw(maybe), order);
+        }
+
+        // Stores `value` if empty. Returns whether it did. Only one of any number of concurrent
+        // publishers to an empty slot succeeds. `value` must not be the sentinel.
+        [[nodiscard]] constexpr auto try_publish(T const value) noexcept -> bool
+        {
+            if consteval {
+                if (!is_empty_value(m_value)) {
+                    return false;
+                }
+                m_value = value;
+                return true;
+            }
+            // Check before the compare-exchange, which takes exclusive ownership of the cache
+            // line even when it fails, so that contended publishers to a full slot stay cheap.
+            T expected = atomic().load(std::memory_order_relaxed);
+            if (!is_empty_value(expected)) {
+                return false;
+            }
+            return atomic().compare_exchange_strong(
+                expected, value, std::memory_order_release, std::memory_order_relaxed);
+        }
+
+        // Empties the slot and returns what it held. Only one of any number of concurrent takers
+        // gets the value.
+        [[nodiscard]] constexpr auto take() noexcept -> Value_maybe
+        {
+            if consteval {
+                return cooked(std::exchange(m_value, Sentinel_config::sentinel_value()));
+            }
+            // An empty slot is left untouched, for the same reason as in `try_publish`.
+            if (is_empty_value(atomic().load(std::memory_order_relaxed))) {
+                return nothing;
+            }
+            return cooked(atomic().exchange(Sentinel_config::sentinel_value(),
+                                            std::memory_order_acq_rel));
+        }
+
+        // Replaces the content of the slot, and returns the previous content.
+        [[nodiscard]] constexpr auto exchange(Value_maybe maybe) noexcept -> Value_maybe
+        {
+            if consteval {
+                return cooked(std::exchange(m_value, raw(maybe)));
+            }
+            return cooked(atomic().exchange(raw(maybe), std::memory_order_acq_rel));
+        }
+
+        // Blocks until the slot is notified and its content differs from `old`. Wait for a value
+        // with `wait(nothing)`. A change that is undone before the waiter wakes may be missed.
+        auto wait(Value_maybe old, std::memory_order const order = std::memory_order_acquire)
+            const noexcept -> void
+        {
+            atomic().wait(raw(old), order);
+        }
+
+        // Wakes threads that are blocked in `wait`. Call after `store`, `try_publish`, `take` or
+        // `exchange` to wake the threads that wait for that change.
+        auto notify_one() const noexcept -> void
+        {
+            atomic().notify_one();
+        }
+
+        auto notify_all() const noexcept -> void
+        {
+            atomic().notify_all();
+        }
+    };
+
+} // namespace aa
@@ -0,0 +1,81 @@
+#include <aa/box.hpp>
+#include <array>
+#include <bit>
+
+namespace {
+
+    constexpr std::size_t min_block_size    = 16;
+    constexpr std::size_t size_class_count  = 6;
+    constexpr std::size_t max_cached_blocks = 256;
+
+    static_assert(min_block_size << (size_class_count - 1) == aa::dtl::box_pool_max_size);
+
+    struct Free_block {
+        Free_block* next;
+    };
+
+    struct Free_list {
+        Free_block* head  = nullptr;
+        std::size_t count = 0;
+    };
+
+    // Set once the pools of the current thread have been destroyed, so that boxes destroyed later
+    // during thread exit release their blocks directly.
+    thread_local bool pools_destroyed = false;
+
+    struct Pools {
+        std::array<Free_list, size_class_count> lists;
+
+        Pools() = default;
+
+        Pools(Pools const&)                    = delete;
+        auto operator=(Pools const&) -> Pools& = delete;
+
+        ~Pools()
+        {
+            for (Free_list& list : lists) {
+                while (list.head != nullptr) {
+                    ::operator delete(std::exchange(list.head, list.head->next));
+                }
+            }
+            pools_destroyed = true;
+        }
+    };
+
+    thread_local Pools pools;
+
+    // 1 to 16 bytes is class 0, 17 to 32 bytes is class 1, and so on.
+    auto size_class(std::size_t const size) noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(std::bit_width((size - 1) | (min_block_size - 1))) - 4;
+    }
+
+} // namespace
+
+auto aa::dtl::box_allocate(std::size_t const size) -> void*
+{
+    std::size_t const index = size_class(size);
+    if (!pools_destroyed) {
+        Free_list& list = pools.lists[index];
+        if (list.head != nullptr) {
+            --list.count;
+            return std::exchange(list.head, list.head->next);
+        }
+    }
+    return ::operator new(min_block_size << index);
+}
+
+// Blocks are cached up to a limit per size class, beyond which they are released to the heap.
+auto aa::dtl::box_deallocate(void* const pointer, std::size_t const size) noexcept -> void
+{
+    std::size_t const index = size_class(size);
+    if (!pools_destroyed) {
+        Free_list& list = pools.lists[index];
+        if (list.count != max_cached_blocks) {
+            list.head = ::new (pointer) Free_block { list.head };
+            ++list.count;
+            return;
+        }
+    }
+    ::operator delete(pointer);
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <aa/utility.hpp>
+#include <cstddef>
+#include <new>
+
+namespace aa::dtl {
+
+    // `Box` allocates objects of up to this many bytes from thread-local free lists of blocks of
+    // 16, 32, 64, 128, 256 or 512 bytes. A block may be released by any thread.
+    inline constexpr std::size_t box_pool_max_size = 512;
+
+    [[nodiscard]] auto box_allocate(std::size_t size) -> void*;
+    auto box_deallocate(void* pointer, std::size_t size) noexcept -> void;
+
+} // namespace aa::dtl
+
+namespace aa {
+
+    // An owning pointer to a heap-allocated `T`, with value semantics: copying a `Box` copies the
+    // object, and constness propagates to it. Only a moved-from or reset `Box` is null, which is
+    // the sentinel, so `Maybe<Box<T>>` is as large as a pointer. A large, rarely constructed
+    // alternative, such as an error type, can be boxed to keep `Result` small.
+    template <class T>
+        requires std::is_object_v<T> && (!std::is_array_v<T>) && std::is_nothrow_destructible_v<T>
+    class Box final {
+        T* m_pointer;
+
+        static constexpr bool pooled = sizeof(T) <= dtl::box_pool_max_size
+                                    && alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+        template <class... Args>
+        [[nodiscard]] static constexpr auto allocate(Args&&... args) -> T*
+        {
+            if constexpr (pooled) {
+                if !consteval {
+                    void* const storage = dtl::box_allocate(sizeof(T));
+                    try {
+                        return ::new (storage) T(std::forward<Args>(args)...);
+                    }
+                    catch (...) {
+                        dtl::box_deallocate(storage, sizeof(T));
+                        throw;
+                    }
+                }
+            }
+            return new T(std::forward<Args>(args)...);
+        }
+
+        static constexpr auto deallocate(T* const pointer) noexcept -> void
+        {
+            if constexpr (pooled) {
+                if !consteval {
+                    std::destroy_at(pointer);
+                    dtl::box_deallocate(pointer, sizeof(T));
+                    return;
+                }
+            }
+            delete pointer;
+        }
+
+        explicit constexpr Box(std::nullptr_t) noexcept : m_pointer { nullptr } {}
+    public:
+        template <class... Args>
+            requires std::is_constructible_v<T, Args&&...>
+        explicit constexpr Box(In_place, Args&&... args)
+            : m_pointer { allocate(std::forward<Args>(args)...) }
+        {}
+
+        constexpr Box(Box const& other)
+            requires std::is_copy_constructible_v<T>
+            : m_pointer { other.m_pointer == nullptr ? nullptr : allocate(*other.m_pointer) }
+        {}
+
+        constexpr Box(Box&& other) noexcept : m_pointer { std::exchange(other.m_pointer, nullptr) }
+        {}
+
+        constexpr auto operator=(Box const& other) -> Box&
+            requires std::is_copy_constructible_v<T>
+        {
+            if (this != &other) {
+                *this = Box { other };
+            }
+            return *this;
+        }
+
+        constexpr auto operator=(Box&& other) noexcept -> Box&
+        {
+            if (this != &other) {
+                reset();
+                m_pointer = std::exchange(other.m_pointer, nullptr);
+            }
+            return *this;
+        }
+
+        constexpr ~Box()
+        {
+            reset();
+        }
+
+        [[nodiscard]] constexpr auto operator*() noexcept -> T&
+        {
+            return *m_pointer;
+        }
+        [[nodiscard]] constexpr auto operator*() const noexcept -> T const&
+        {
+            return *m_pointer;
+        }
+        [[nodiscard]] constexpr auto operator->() noexcept -> T*
+        {
+            return m_pointer;
+        }
+        [[nodiscard]] constexpr auto operator->() const noexcept -> T const*
+        {
+            return m_pointer;
+        }
+        [[nodiscard]] constexpr auto get() noexcept -> T*
+        {
+            return m_pointer;
+        }
+        [[nodiscard]] constexpr auto get() const noexcept -> T const*
+        {
+            return m_pointer;
+        }
+
+        // Destroy the object, leaving the box null.
+        constexpr auto reset() noexcept -> void
+        {
+            if (m_pointer != nullptr) {
+                deallocate(std::exchange(m_pointer, nullptr));
+            }
+        }
+
+        // Dangerous escape hatch for special cases, such as sentinel values.
+        [[nodiscard]] static constexpr auto unsafe_construct_null_box() noexcept -> Box
+        {
+            return Box { nullptr };
+        }
+    };
+
+    template <class T>
+    struct Sentinel_config_default_for<Box<T>> final {
+        Sentinel_config_default_for() = delete;
+        static constexpr auto sentinel_value() noexcept -> Box<T>
+        {
+            return Box<T>::unsafe_construct_null_box();
+        }
+        static constexpr auto is_sentinel_value(Box<T> const& box) noexcept -> bool
+        {
+            return box.get() == nullptr;
+        }
+    };
+
+    template <class T>
+    struct Trivially_relocatable<Box<T>> : std::true_type {};
+
+} // namespace aa
+
+namespace aa::inline basics {
+    using aa::Box;
+}
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <aa/lazy.hpp>
+#include <aa/utility.hpp>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+// Makes `Maybe` and `Result` usable as coroutine return types. In such a coroutine, `co_await`
+// on a `Maybe` or `Result` gives its value, or returns its error, or `nothing`, from the
+// coroutine, like an early return. `co_return` returns anything that converts to the return type.
+//
+// The coroutine never outlives the call: it runs to completion or to its first failed `co_await`
+// before the call returns, and the return object that the call is converted from destroys the
+// frame. An exception that escapes the coroutine propagates to the caller. The handle never
+// escapes, so compilers that elide the allocation of frames whose lifetime is contained in the
+// caller (HALO) can do so once the coroutine is inlined.
+
+// Before GCC 14, GCC destroys the frame itself when an exception leaves the call of a coroutine,
+// even once the coroutine has started, instead of leaving it to the owner of the handle.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 14
+#define AA_COROUTINE_CALL_DESTROYS_FRAME_ON_EXCEPTION 1
+#else
+#define AA_COROUTINE_CALL_DESTROYS_FRAME_ON_EXCEPTION 0
+#endif
+
+namespace aa::dtl {
+
+    // Coroutine frames that never outlive the call are freed in the reverse order in which they
+    // were allocated, so they are allocated from a stack per thread instead of the heap. This is
+    // for compilers that do not elide the allocation. Frames that do not fit use the heap.
+    class Frame_stack final {
+        static constexpr std::size_t alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+        static constexpr std::size_t capacity  = 16 * 1024;
+
+        alignas(alignment) std::byte m_buffer[capacity];
+        std::size_t m_size;
+
+        [[nodiscard]] static constexpr auto rounded(std::size_t const size) noexcept -> std::size_t
+        {
+            return (size + alignment - 1) / alignment * alignment;
+        }
+    public:
+        [[nodiscard]] auto allocate(std::size_t const size) -> void*
+        {
+            if (capacity - m_size < rounded(size)) {
+                return ::operator new(size);
+            }
+            void* const frame = m_buffer + m_size;
+            m_size += rounded(size);
+            return frame;
+        }
+
+        auto deallocate(void* const frame, std::size_t const size) noexcept -> void
+        {
+            auto const offset = reinterpret_cast<std::uintptr_t>(frame) // NOLINT: address
+                              - reinterpret_cast<std::uintptr_t>(m_buffer); // NOLINT: address
+            if (offset >= capacity) {
+                ::operator delete(frame); // Unsized, which needs no flag on older clang versions.
+                return;
+            }
+            m_size -= rounded(size);
+        }
+    };
+
+    // Zero-initialized, so it takes no space in the binary and needs no initialization guard.
+    inline thread_local constinit Frame_stack frame_stack {};
+
+    template <class Return>
+    class Coroutine_promise;
+
+    // Owns the frame, which holds the result, and destroys it when converted or destroyed.
+    template <class Return>
+    class Coroutine_return_object final {
+        std::coroutine_handle<Coroutine_promise<Return>> m_handle;
+    public:
+        explicit Coroutine_return_object(
+            std::coroutine_handle<Coroutine_promise<Return>> const handle) noexcept
+            : m_handle { handle }
+        {}
+
+        Coroutine_return_object(Coroutine_return_object&& other) noexcept
+            : m_handle { std::exchange(other.m_handle, {}) }
+        {}
+
+        auto operator=(Coroutine_return_object&&) -> Coroutine_return_object& = delete;
+
+        ~Coroutine_return_object()
+        {
+#if AA_COROUTINE_CALL_DESTROYS_FRAME_ON_EXCEPTION
+            if (m_handle && m_handle.promise().m_threw) {
+                return;
+            }
+#endif
+            if (m_handle) {
+                m_handle.destroy();
+            }
+        }
+
+        // The standard does not say when the return object is converted. Clang and GCC convert it
+        // once the call has run the coroutine, and converting it before the coroutine has
+        // returned or failed is caught by `unwrap` where access is checked.
+        [[nodiscard]] operator Return() // NOLINT: implicit
+        {
+            Return result = std::move(m_handle.promise().m_result).unwrap();
+            std::exchange(m_handle, {}).destroy();
+            return result;
+        }
+    };
+
+    // Awaits `M`, which is a reference to the awaited `Maybe` or `Result`. The awaited object
+    // lives until the end of the full expression that contains the `co_await`.
+    template <class M>
+    class Coroutine_awaiter final {
+        M m_awaited;
+    public:
+        explicit Coroutine_awaiter(M awaited) noexcept : m_awaited { std::forward<M>(awaited) } {}
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool
+        {
+            return m_awaited.has_value();
+        }
+
+        // Leaves the coroutine suspended, which returns control to the caller, whose return object
+        // destroys the frame.
+        template <class Return>
+        auto await_suspend(std::coroutine_handle<Coroutine_promise<Return>> const handle) -> void
+        {
+            handle.promise().fail(std::forward<M>(m_awaited));
+        }
+
+        [[nodiscard]] auto await_resume()
+            -> Unwrap_result<M, decltype(std::forward<M>(m_awaited).unwrap_unchecked())>
+        {
+            return std::forward<M>(m_awaited).unwrap_unchecked();
+        }
+    };
+
+    // What can be awaited in a coroutine that returns `Return`: a `Maybe` in a coroutine that
+    // returns `Maybe`, and a `Result` whose error converts to the error of `Return` in a
+    // coroutine that returns `Result`.
+    template <class M, class Return>
+    concept coroutine_awaitable = requires {
+        requires lazy_maybe_like<M>;
+        requires lazy_result_like<M> == lazy_result_like<Return&>;
+        requires !lazy_result_like<M>
+                     || std::is_constructible_v<
+                         Return,
+                         In_place_error,
+                         decltype(std::declval<M>().unwrap_err_unchecked())>;
+    };
+
+    template <class Return>
+    class Coroutine_promise final {
+        // Empty until the coroutine returns or fails.
+        Maybe<Return> m_result;
+
+#if AA_COROUTINE_CALL_DESTROYS_FRAME_ON_EXCEPTION
+        bool m_threw {};
+#endif
+
+        friend class Coroutine_return_object<Return>;
+
+        template <class>
+        friend class Coroutine_awaiter;
+
+        template <class M>
+        auto fail(M&& awaited) -> void
+        {
+            if constexpr (lazy_result_like<M>) {
+                m_result.emplace(in_place_error, std::forward<M>(awaited).unwrap_err_unchecked());
+            }
+            else {
+                m_result.emplace(nothing);
+            }
+        }
+    public:
+        [[nodiscard]] static auto operator new(std::size_t const size) -> void*
+        {
+            return frame_stack.allocate(size);
+        }
+
+        static auto operator delete(void* const frame, std::size_t const size) noexcept -> void
+        {
+            frame_stack.deallocate(frame, size);
+        }
+
+        [[nodiscard]] auto get_return_object() noexcept -> Coroutine_return_object<Return>
+        {
+            return Coroutine_return_object<Return>(
+                std::coroutine_handle<Coroutine_promise>::from_promise(*this));
+        }
+
+        [[nodiscard]] static auto initial_suspend() noexcept -> std::suspend_never
+        {
+            return {};
+        }
+
+        // The result is in the frame, so the frame lives until the return object is converted.
+        [[nodiscard]] static auto final_suspend() noexcept -> std::suspend_always
+        {
+            return {};
+        }
+
+        template <class Value>
+            requires std::is_constructible_v<Return, Value&&>
+        auto return_value(Value&& value) -> void
+        {
+            m_result.emplace(std::forward<Value>(value));
+        }
+
+        // Rethrowing leaves the coroutine suspended at its final suspend point, and the exception
+        // propagates to the caller. The return object is not converted then, so its destructor
+        // destroys the frame, unless the call already does.
+        auto unhandled_exception() -> void
+        {
+#if AA_COROUTINE_CALL_DESTROYS_FRAME_ON_EXCEPTION
+            m_threw = true;
+#endif
+            throw;
+        }
+
+        template <class M>
+            requires coroutine_awaitable<M&&, Return>
+        [[nodiscard]] static auto await_transform(M&& awaited) noexcept -> Coroutine_awaiter<M&&>
+        {
+            return Coroutine_awaiter<M&&>(std::forward<M>(awaited));
+        }
+    };
+
+} // namespace aa::dtl
+
+template <class Return, class... Args>
+    requires aa::specialization_of<Return, aa::Maybe> || aa::specialization_of<Return, aa::Result>
+struct std::coroutine_traits<Return, Args...> {
+    using promise_type = aa::dtl::Coroutine_promise<Return>;
+};
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <aa/maybe.hpp>
+#include <aa/utility.hpp>
+#include <algorithm>
+#include <cstddef>
+
+namespace aa::dtl {
+
+    // Constant evaluation cannot construct an element of an inactive union array, so types that
+    // can be left uninitialized are stored in a plain array instead.
+    template <
+        class T,
+        std::size_t capacity,
+        bool = std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>>
+    struct Inline_storage {
+        T m_values[capacity]; // NOLINT: C array, so that elements start uninitialized
+    };
+
+    template <class T, std::size_t capacity>
+    struct Inline_storage<T, capacity, false> {
+        union {
+            T m_values[capacity]; // NOLINT: C array, so that elements start uninitialized
+        };
+
+        constexpr Inline_storage() noexcept {}
+
+        Inline_storage(Inline_storage const&)                    = default;
+        Inline_storage(Inline_storage&&)                         = default;
+        auto operator=(Inline_storage const&) -> Inline_storage& = default;
+        auto operator=(Inline_storage&&) -> Inline_storage&      = default;
+
+        ~Inline_storage()
+            requires std::is_trivially_destructible_v<T>
+        = default;
+
+        // The elements are destroyed by the vector.
+        constexpr ~Inline_storage()
+            requires(!std::is_trivially_destructible_v<T>)
+        {}
+    };
+
+} // namespace aa::dtl
+
+namespace aa {
+
+    // A vector whose elements are stored in the object itself, so it never allocates. Adding an
+    // element to a full vector fails instead of throwing. Trivially copyable if `T` is. Usable in
+    // constant evaluation only if `T` is trivially default constructible and destructible.
+    template <sane T, std::size_t inline_capacity>
+        requires(inline_capacity != 0)
+    class Inline_vector final {
+        dtl::Inline_storage<T, inline_capacity> m_storage;
+        dtl::Smallest_unsigned<inline_capacity> m_size {};
+
+        static constexpr bool trivial_copy_assignment = std::is_trivially_copy_assignable_v<T>
+                                                     && std::is_trivially_copy_constructible_v<T>
+                                                     && std::is_trivially_destructible_v<T>;
+
+        static constexpr bool trivial_move_assignment = std::is_trivially_move_assignable_v<T>
+                                                     && std::is_trivially_move_constructible_v<T>
+                                                     && std::is_trivially_destructible_v<T>;
+
+        // Assign the elements of `other` to the common prefix, then construct or destroy the rest.
+        template <class Other>
+        constexpr auto assign_elements(Other&& other) noexcept(
+            std::is_rvalue_reference_v<Other&&> || nothrow_copyable<T>) -> void
+        {
+            std::size_t const common = std::min(size(), other.size());
+            for (std::size_t index = 0; index != common; ++index) {
+                if constexpr (std::is_rvalue_reference_v<Other&&>) {
+                    move_assign(data()[index], std::move(other.data()[index]));
+                }
+                else {
+                    copy_assign(data()[index], other.data()[index]);
+                }
+            }
+            while (size() > other.size()) {
+                std::destroy_at(data() + --m_size);
+            }
+            while (size() < other.size()) {
+                std::construct_at(data() + m_size, std::forward_like<Other>(other.data()[m_size]));
+                ++m_size;
+            }
+        }
+    public:
+        constexpr Inline_vector() noexcept {}
+
+        Inline_vector(Inline_vector const&)
+            requires(!std::is_copy_constructible_v<T>)
+        = delete;
+        Inline_vector(Inline_vector const&)
+            requires std::is_trivially_copy_constructible_v<T>
+        = default;
+
+        constexpr Inline_vector(Inline_vector const& other)
+            noexcept(std::is_nothrow_copy_constructible_v<T>)
+            requires std::is_copy_constructible_v<T> && (!std::is_trivially_copy_constructible_v<T>)
+            : Inline_vector() // Delegate so that the destructor runs if a copy throws.
+        {
+            for (; m_size != other.m_size; ++m_size) {
+                std::construct_at(data() + m_size, other.data()[m_size]);
+            }
+        }
+
+        Inline_vector(Inline_vector&&)
+            requires(!std::is_move_constructible_v<T>)
+        = delete;
+        Inline_vector(Inline_vector&&)
+            requires std::is_trivially_move_constructible_v<T>
+        = default;
+
+        // The elements of `other` are moved from, but not destroyed.
+        constexpr Inline_vector(Inline_vector&& other) noexcept
+            requires std::is_move_constructible_v<T> && (!std::is_trivially_move_constructible_v<T>)
+        {
+            for (; m_size != other.m_size; ++m_size) {
+                std::construct_at(data() + m_size, std::move(other.data()[m_size]));
+            }
+        }
+
+        auto operator=(Inline_vector const&) -> Inline_vector&
+            requires(!std::is_copy_constructible_v<T>)
+        = delete;
+        auto operator=(Inline_vector const&) -> Inline_vector&
+            requires trivial_copy_assignment
+        = default;
+
+        constexpr auto operator=(Inline_vector const& other)
+            noexcept(nothrow_copyable<T>) -> Inline_vector&
+            requires std::is_copy_constructible_v<T> && (!trivial_copy_assignment)
+        {
+            if (this != &other) {
+                assign_elements(other);
+            }
+            return *this;
+        }
+
+        auto operator=(Inline_vector&&) -> Inline_vector&
+            requires(!std::is_move_constructible_v<T>)
+        = delete;
+        auto operator=(Inline_vector&&) noexcept -> Inline_vector&
+            requires trivial_move_assignment
+        = default;
+
+        constexpr auto operator=(Inline_vector&& other) noexcept -> Inline_vector&
+            requires std::is_move_constructible_v<T> && (!trivial_move_assignment)
+        {
+            if (this != &other) {
+                assign_elements(std::move(other));
+            }
+            return *this;
+        }
+
+        ~Inline_vector()
+            requires std::is_trivially_destructible_v<T>
+        = default;
+
+        constexpr ~Inline_vector()
+            requires(!std::is_trivially_destructible_v<T>)
+        {
+            clear();
+        }
+
+        [[nodiscard]] static constexpr auto capacity() noexcept -> std::size_t
+        {
+            return inline_capacity;
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return m_size;
+        }
+
+        [[nodiscard]] constexpr auto is_empty() const noexcept -> bool
+        {
+            return m_size == 0;
+        }
+
+        [[nodiscard]] constexpr auto is_full() const noexcept -> bool
+        {
+            return m_size == inline_capacity;
+        }
+
+        // Construct an element at the end, unless the vector is full.
+        template <class... Args>
+            requires std::is_constructible_v<T, Args&&...>
+        constexpr auto try_emplace_back(Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>) -> Maybe<Ref<T>>
+        {
+            if (is_full()) {
+                return nothing;
+            }
+            T& element = *std::construct_at(data() + m_size, std::forward<Args>(args)...);
+            ++m_size;
+            return Ref { element };
+        }
+
+        template <class Arg = T>
+            requires(!tag_type<std::remove_cvref_t<Arg>>) && std::is_constructible_v<T, Arg&&>
+        constexpr auto try_push_back(Arg&& arg)
+            noexcept(std::is_nothrow_constructible_v<T, Arg&&>) -> Maybe<Ref<T>>
+        {
+            return try_emplace_back(std::forward<Arg>(arg));
+        }
+
+        // Remove the last element and return it, unless the vector is empty.
+        constexpr auto pop_back() noexcept -> Maybe<T>
+            requires std::is_move_constructible_v<T>
+        {
+            if (is_empty()) {
+                return nothing;
+            }
+            Maybe<T> element { in_place, std::move(data()[m_size - 1]) };
+            std::destroy_at(data() + --m_size);
+            return element;
+        }
+
+        constexpr auto clear() noexcept -> void
+        {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                std::destroy(data(), data() + m_size);
+            }
+            m_size = 0;
+        }
+
+        // Precondition: `index < size()`
+        [[nodiscard]] constexpr auto operator[](std::size_t const index) noexcept -> T&
+        {
+            return data()[index];
+        }
+
+        // Precondition: `index < size()`
+        [[nodiscard]] constexpr auto operator[](std::size_t const index) const noexcept
+            -> T const&
+        {
+            return data()[index];
+        }
+
+        [[nodiscard]] constexpr auto data() noexcept -> T*
+        {
+            return m_storage.m_values; // NOLINT: union access
+        }
+
+        [[nodiscard]] constexpr auto data() const noexcept -> T const*
+        {
+            return m_storage.m_values; // NOLINT: union access
+        }
+
+        [[nodiscard]] constexpr auto begin() noexcept -> T*
+        {
+            return data();
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept -> T const*
+        {
+            return data();
+        }
+
+        [[nodiscard]] constexpr auto end() noexcept -> T*
+        {
+            return data() + m_size;
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept -> T const*
+        {
+            return data() + m_size;
+        }
+    };
+
+    template <class T, std::size_t inline_capacity>
+    struct Trivially_relocatable<Inline_vector<T, inline_capacity>> : Trivially_relocatable<T> {};
+
+} // namespace aa
+
+namespace aa::inline basics {
+    using aa::Inline_vector;
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <aa/utility.hpp>
+#include <functional>
+
+// The nodes of lazy `Maybe` and `Result` pipelines. A node is evaluated by calling
+// `evaluate<R>(on_value, on_error)`, which calls exactly one of the two with the value or the error
+// of the pipeline, and returns its result. `on_error` is called without arguments for `Maybe`.
+// Each step passes its value straight to the next step's callable, so no intermediate `Maybe` or
+// `Result` is constructed, and every `map` step after the first presence test is unconditional.
+
+namespace aa::dtl {
+
+    template <class M>
+    concept lazy_maybe_like = requires(M&& maybe) {
+        { maybe.has_value() } -> std::same_as<bool>;
+        std::forward<M>(maybe).unwrap_unchecked();
+    };
+
+    template <class M>
+    concept lazy_result_like = lazy_maybe_like<M> && requires(M&& result) {
+        std::forward<M>(result).unwrap_err_unchecked();
+    };
+
+    // The type with which the error of `M` is passed on, or void if it has none.
+    template <class M>
+    struct Lazy_error : std::type_identity<void> {};
+
+    template <lazy_result_like M>
+    struct Lazy_error<M> : std::type_identity<decltype(std::declval<M>().unwrap_err_unchecked())> {};
+
+    // Unwrapping an lvalue gives a reference into it. Unwrapping an rvalue moves the value out,
+    // since the rvalue may be a temporary that is gone before the reference is used.
+    template <class M, class Unwrapped>
+    using Unwrap_result = std::
+        conditional_t<std::is_lvalue_reference_v<M>, Unwrapped, std::remove_cvref_t<Unwrapped>>;
+
+    template <class R, class M, class On_error>
+    constexpr auto lazy_forward_error(M&& maybe, On_error& on_error) -> R
+    {
+        if constexpr (lazy_result_like<M>) {
+            return on_error(std::forward<M>(maybe).unwrap_err_unchecked());
+        }
+        else {
+            return on_error();
+        }
+    }
+
+    // `Source` is a reference to the `Maybe` or `Result` that the pipeline starts from.
+    template <class Source>
+    struct Lazy_source {
+        Source m_source;
+
+        using Value = decltype(std::declval<Source>().unwrap_unchecked());
+        using Error = typename Lazy_error<Source>::type;
+
+        template <class R, class On_value, class On_error>
+        constexpr auto evaluate(On_value& on_value, On_error& on_error) -> R
+        {
+            if (m_source.has_value()) {
+                return on_value(std::forward<Source>(m_source).unwrap_unchecked());
+            }
+            return lazy_forward_error<R>(std::forward<Source>(m_source), on_error);
+        }
+    };
+
+    template <class Parent, class Function>
+    struct Lazy_map {
+        Parent   m_parent;
+        Function m_function;
+
+        using Value = std::invoke_result_t<Function, typename Parent::Value>;
+        using Error = typename Parent::Error;
+
+        template <class R, class On_value, class On_error>
+        constexpr auto evaluate(On_value& on_value, On_error& on_error) -> R
+        {
+            auto on_parent_value = [&]<class V>(V&& value) -> R {
+                return on_value(std::invoke(std::move(m_function), std::forward<V>(value)));
+            };
+            return m_parent.template evaluate<R>(on_parent_value, on_error);
+        }
+
+        // Like `evaluate`, but passes `on_invoke` the function and its argument instead of their
+        // result, so that the result of the last step can be constructed in place.
+        template <class R, class On_invoke, class On_error>
+        constexpr auto evaluate_invoke(On_invoke& on_invoke, On_error& on_error) -> R
+        {
+            auto on_parent_value = [&]<class V>(V&& value) -> R {
+                return on_invoke(std::move(m_function), std::forward<V>(value));
+            };
+            return m_parent.template evaluate<R>(on_parent_value, on_error);
+        }
+    };
+
+    template <class Parent, class Function>
+    struct Lazy_map_err {
+        Parent   m_parent;
+        Function m_function;
+
+        using Value = typename Parent::Value;
+        using Error = std::invoke_result_t<Function, typename Parent::Error>;
+
+        template <class R, class On_value, class On_error>
+        constexpr auto evaluate(On_value& on_value, On_error& on_error) -> R
+        {
+            auto on_parent_error = [&]<class E>(E&& error) -> R {
+                return on_error(std::invoke(std::move(m_function), std::forward<E>(error)));
+            };
+            return m_parent.template evaluate<R>(on_value, on_parent_error);
+        }
+    };
+
+    // `Function` returns a `Maybe` or `Result`, whose value or error is passed on.
+    template <class Parent, class Function>
+    struct Lazy_and_then {
+        Parent   m_parent;
+        Function m_function;
+
+        using Next  = std::invoke_result_t<Function, typename Parent::Value>;
+        using Value = decltype(std::declval<Next>().unwrap_unchecked());
+        using Error = typename Parent::Error;
+
+        template <class R, class On_value, class On_error>
+        constexpr auto evaluate(On_value& on_value, On_error& on_error) -> R
+        {
+            auto on_parent_value = [&]<class V>(V&& value) -> R {
+                Next next = std::invoke(std::move(m_function), std::forward<V>(value));
+                if (next.has_value()) {
+                    return on_value(std::forward<Next>(next).unwrap_unchecked());
+                }
+                return lazy_forward_error<R>(std::forward<Next>(next), on_error);
+            };
+            return m_parent.template evaluate<R>(on_parent_value, on_error);
+        }
+    };
+
+    // `Function` is called with the error, or without arguments for `Maybe`, and returns a `Maybe`
+    // or `Result` whose value takes the place of the missing one.
+    template <class Parent, class Function, class... Args>
+    struct Lazy_or_else_impl {
+        Parent   m_parent;
+        Function m_function;
+
+        using Next  = std::invoke_result_t<Function, Args...>;
+        using Value = std::common_reference_t<
+            typename Parent::Value,
+            decltype(std::declval<Next>().unwrap_unchecked())>;
+        using Error = typename Lazy_error<Next>::type;
+
+        template <class R, class On_value, class On_error>
+        constexpr auto evaluate(On_value& on_value, On_error& on_error) -> R
+        {
+            auto on_parent_error = [&]<class... E>(E&&... error) -> R {
+                Next next = std::invoke(std::move(m_function), std::forward<E>(error)...);
+                if (next.has_value()) {
+                    return on_value(std::forward<Next>(next).unwrap_unchecked());
+                }
+                return lazy_forward_error<R>(std::forward<Next>(next), on_error);
+            };
+            return m_parent.template evaluate<R>(on_value, on_parent_error);
+        }
+    };
+
+    template <class Parent, class Function>
+    using Lazy_or_else = std::conditional_t<
+        std::is_void_v<typename Parent::Error>,
+        Lazy_or_else_impl<Parent, Function>,
+        Lazy_or_else_impl<Parent, Function, typename Parent::Error>>;
+
+    // Evaluates `node`, and calls `on_invoke` with a function and an argument that give its value.
+    // If the last step is a `map`, they are that step's, so the value is constructed in place.
+    template <class R, class Node, class On_invoke, class On_error>
+    constexpr auto lazy_evaluate_invoke(Node& node, On_invoke& on_invoke, On_error& on_error) -> R
+    {
+        if constexpr (requires { node.template evaluate_invoke<R>(on_invoke, on_error); }) {
+            return node.template evaluate_invoke<R>(on_invoke, on_error);
+        }
+        else {
+            auto on_value = [&]<class V>(V&& value) -> R {
+                return on_invoke(std::identity {}, std::forward<V>(value));
+            };
+            return node.template evaluate<R>(on_value, on_error);
+        }
+    }
+
+} // namespace aa::dtl
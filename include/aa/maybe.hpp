@@ -1,6 +1,8 @@
 #pragma once
 
 #include <aa/utility.hpp>
+#include <aa/lazy.hpp>
+#include <functional>
 
 namespace aa::dtl {
     template <sane T, sentinel_config<T> Config>
@@ -19,6 +21,12 @@ namespace aa::dtl {
             : m_value(std::forward<Args>(args)...)
         {}
 
+        template <class Function, class... Args>
+        explicit constexpr Maybe_core(In_place_invoke, Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>)
+            : m_value(std::invoke(std::forward<Function>(function), std::forward<Args>(args)...))
+        {}
+
         [[nodiscard]] constexpr auto has_value() const
             noexcept(noexcept(Config::is_sentinel_value(m_value))) -> bool
         {
@@ -32,6 +40,25 @@ namespace aa::dtl {
             move_assign(m_value, T(std::forward<Args>(args)...));
         }
 
+        // Basic guarantee: if `function` throws, the core holds the sentinel.
+        template <class Function, class... Args>
+        constexpr auto emplace_with(Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>) -> void
+        {
+            std::destroy_at(this);
+            try {
+                std::construct_at(
+                    this,
+                    in_place_invoke,
+                    std::forward<Function>(function),
+                    std::forward<Args>(args)...);
+            }
+            catch (...) {
+                std::construct_at(this);
+                throw;
+            }
+        }
+
         constexpr auto reset() noexcept -> void
             requires(std::is_move_constructible_v<T> || std::is_move_assignable_v<T>)
         {
@@ -47,6 +74,15 @@ namespace aa::dtl {
         };
         bool m_has_value = false;
 
+        // Assignment may construct or destroy the value, so it is only trivial if those are too.
+        static constexpr bool trivial_copy_assignment = std::is_trivially_copy_assignable_v<T>
+                                                     && std::is_trivially_copy_constructible_v<T>
+                                                     && std::is_trivially_destructible_v<T>;
+
+        static constexpr bool trivial_move_assignment = std::is_trivially_move_assignable_v<T>
+                                                     && std::is_trivially_move_constructible_v<T>
+                                                     && std::is_trivially_destructible_v<T>;
+
         constexpr Maybe_core() noexcept {}
 
         template <class... Args>
@@ -56,6 +92,13 @@ namespace aa::dtl {
             , m_has_value(true)
         {}
 
+        template <class Function, class... Args>
+        explicit constexpr Maybe_core(In_place_invoke, Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>)
+            : m_value(std::invoke(std::forward<Function>(function), std::forward<Args>(args)...))
+            , m_has_value(true)
+        {}
+
         [[nodiscard]] constexpr auto has_value() const noexcept -> bool
         {
             return m_has_value;
@@ -81,6 +124,27 @@ namespace aa::dtl {
             m_has_value = true;
         }
 
+        // The whole core is reconstructed, because only a constructor's member initializer can
+        // elide the result of `function` into `m_value`. Basic guarantee: if `function` throws,
+        // the core is empty.
+        template <class Function, class... Args>
+        constexpr auto emplace_with(Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>) -> void
+        {
+            std::destroy_at(this);
+            try {
+                std::construct_at(
+                    this,
+                    in_place_invoke,
+                    std::forward<Function>(function),
+                    std::forward<Args>(args)...);
+            }
+            catch (...) {
+                std::construct_at(this);
+                throw;
+            }
+        }
+
         constexpr auto reset() noexcept -> void
         {
             if (m_has_value) {
@@ -124,15 +188,15 @@ namespace aa::dtl {
         }
 
         auto operator=(Maybe_core const&) -> Maybe_core&
-            requires(!std::is_copy_assignable_v<T>)
+            requires(!std::is_copy_constructible_v<T>)
         = delete;
         auto operator=(Maybe_core const&) -> Maybe_core&
-            requires std::is_trivially_copy_assignable_v<T>
+            requires trivial_copy_assignment
         = default;
 
         constexpr auto operator=(Maybe_core const& other)
             noexcept(nothrow_copyable<T>) -> Maybe_core&
-            requires std::is_copy_constructible_v<T> && (!std::is_trivially_copy_assignable_v<T>)
+            requires std::is_copy_constructible_v<T> && (!trivial_copy_assignment)
         {
             if (this != &other) {
                 if (!other.m_has_value) {
@@ -152,14 +216,14 @@ namespace aa::dtl {
         }
 
         auto operator=(Maybe_core&&) -> Maybe_core&
-            requires(!std::is_move_assignable_v<T>)
+            requires(!std::is_move_constructible_v<T>)
         = delete;
         auto operator=(Maybe_core&&) noexcept -> Maybe_core&
-            requires std::is_trivially_move_assignable_v<T>
+            requires trivial_move_assignment
         = default;
 
         constexpr auto operator=(Maybe_core&& other) noexcept -> Maybe_core&
-            requires std::is_move_constructible_v<T> && (!std::is_trivially_move_assignable_v<T>)
+            requires std::is_move_constructible_v<T> && (!trivial_move_assignment)
         {
             if (this != &other) {
                 if (!other.m_has_value) {
@@ -178,6 +242,15 @@ namespace aa::dtl {
             return *this;
         }
     };
+
+    // Grants batch algorithms direct access to the storage of `Maybe`.
+    struct Maybe_access {
+        template <class M>
+        [[nodiscard]] static constexpr auto core(M& maybe) noexcept -> auto&
+        {
+            return maybe.m_core;
+        }
+    };
 } // namespace aa::dtl
 
 namespace aa {
@@ -187,6 +260,9 @@ namespace aa {
     };
     inline constexpr Nothing nothing { detail::Internal_construct_tag {} };
 
+    template <class Node, access_config Unwrap_config, access_config Deref_config>
+    class Lazy_maybe;
+
     template <
         sane               T,
         access_config      Unwrap_config   = Access_config_checked,
@@ -195,6 +271,8 @@ namespace aa {
     class [[nodiscard]] Maybe final {
         dtl::Maybe_core<T, Sentinel_config> m_core;
 
+        friend struct dtl::Maybe_access;
+
         static constexpr bool nothrow_unwrap = noexcept(Unwrap_config::validate_access(bool {}));
         static constexpr bool nothrow_deref  = noexcept(Deref_config::validate_access(bool {}));
     public:
@@ -207,6 +285,13 @@ namespace aa {
             : m_core(in_place, std::forward<Args>(args)...)
         {}
 
+        template <class Function, class... Args>
+        explicit constexpr Maybe(In_place_invoke, Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>)
+            requires std::is_invocable_r_v<T, Function&&, Args&&...>
+            : m_core(in_place_invoke, std::forward<Function>(function), std::forward<Args>(args)...)
+        {}
+
         template <class Arg = T>
             requires(!tag_type<std::remove_cvref_t<Arg>>)
                  && (!std::is_same_v<Maybe, std::remove_cvref_t<Arg>>)
@@ -243,11 +328,22 @@ namespace aa {
             return m_core.m_value;
         }
 
+        // Like `emplace`, but the value is the result of invoking `function` with `args`.
+        template <class Function, class... Args>
+            requires std::is_invocable_r_v<T, Function&&, Args&&...>
+        constexpr auto emplace_with(Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>) -> T&
+        {
+            m_core.emplace_with(std::forward<Function>(function), std::forward<Args>(args)...);
+            return m_core.m_value;
+        }
+
         template <class Self>
-        [[nodiscard]] constexpr auto unwrap(this Self&& self)
+        [[nodiscard]] constexpr auto unwrap(
+            this Self&& self, std::source_location const caller = std::source_location::current())
             noexcept(nothrow_unwrap) -> Qualified_like<Self, T>
         {
-            Unwrap_config::validate_access(self.has_value());
+            dtl::validate_access<Unwrap_config>(self.has_value(), caller);
             return std::forward_like<Self>(self.m_core.m_value);
         }
 
@@ -273,6 +369,25 @@ namespace aa {
             return std::addressof(self.m_core.m_value);
         }
 
+        // `Maybe` is a contiguous range of zero or one elements, so it works with range algorithms
+        // and views. For example, `std::views::join` flattens a range of `Maybe` to its values.
+        [[nodiscard]] constexpr auto begin(this auto& self) noexcept
+            -> decltype(std::addressof(self.m_core.m_value))
+        {
+            return std::addressof(self.m_core.m_value);
+        }
+
+        [[nodiscard]] constexpr auto end(this auto& self) noexcept
+            -> decltype(std::addressof(self.m_core.m_value))
+        {
+            return self.begin() + self.size();
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return has_value() ? 1 : 0;
+        }
+
         template <class Self, std::invocable<Qualified_like<Self, T>> Function>
         [[nodiscard]] constexpr auto map(this Self&& self, Function&& function)
             noexcept(std::is_nothrow_invocable_v<Function&&, Qualified_like<Self, T>>)
@@ -288,10 +403,9 @@ namespace aa {
                 std::invoke_result_t<Function, Qualified_like<Self, T>>,
                 Unwrap_config,
                 Deref_config>(
-                in_place,
-                std::invoke(
-                    std::forward<Function>(function),
-                    std::forward_like<Self>(self.m_core.m_value)));
+                in_place_invoke,
+                std::forward<Function>(function),
+                std::forward_like<Self>(self.m_core.m_value));
         }
 
         template <class Self, std::invocable<Qualified_like<Self, T>> Function>
@@ -324,6 +438,96 @@ namespace aa {
 
         auto ref() &&      = delete;
         auto ref() const&& = delete;
+
+        // Start a lazy pipeline, which refers to this `Maybe` until it is evaluated. Nothing keeps
+        // the pipeline from outliving it: `auto pipeline = make().lazy();` dangles.
+        template <class Self>
+        [[nodiscard]] constexpr auto lazy(this Self&& self) noexcept
+            -> Lazy_maybe<dtl::Lazy_source<Self&&>, Unwrap_config, Deref_config>
+        {
+            return Lazy_maybe<dtl::Lazy_source<Self&&>, Unwrap_config, Deref_config>(
+                dtl::Lazy_source<Self&&> { std::forward<Self>(self) });
+        }
+    };
+
+    // The presence flag or sentinel holds no pointers, so `Maybe` relocates like its value.
+    template <class T, class... Configs>
+    struct Trivially_relocatable<Maybe<T, Configs...>> : Trivially_relocatable<T> {};
+
+    // A chain of `map`, `and_then` and `or_else` steps, which is evaluated at once by `value_or` or
+    // `evaluate`. Unlike the same chain on `Maybe`, it constructs no intermediate `Maybe`.
+    // Every operation consumes the pipeline, so it has to be used as a single expression.
+    template <class Node, access_config Unwrap_config, access_config Deref_config>
+    class [[nodiscard]] Lazy_maybe final {
+        Node m_node;
+
+        using Value = std::remove_cvref_t<typename Node::Value>;
+
+        template <class Next_node>
+        using Next = Lazy_maybe<Next_node, Unwrap_config, Deref_config>;
+    public:
+        explicit constexpr Lazy_maybe(Node node) noexcept(std::is_nothrow_move_constructible_v<Node>)
+            : m_node(std::move(node))
+        {}
+
+        template <std::invocable<typename Node::Value> Function>
+            requires(!std::is_void_v<std::invoke_result_t<Function, typename Node::Value>>)
+        [[nodiscard]] constexpr auto map(Function&& function) &&
+            -> Next<dtl::Lazy_map<Node, std::decay_t<Function>>>
+        {
+            return Next<dtl::Lazy_map<Node, std::decay_t<Function>>>(
+                { std::move(m_node), std::forward<Function>(function) });
+        }
+
+        // `function` returns a `Maybe`.
+        template <std::invocable<typename Node::Value> Function>
+            requires dtl::lazy_maybe_like<std::invoke_result_t<Function, typename Node::Value>>
+                  && (!dtl::lazy_result_like<std::invoke_result_t<Function, typename Node::Value>>)
+        [[nodiscard]] constexpr auto and_then(Function&& function) &&
+            -> Next<dtl::Lazy_and_then<Node, std::decay_t<Function>>>
+        {
+            return Next<dtl::Lazy_and_then<Node, std::decay_t<Function>>>(
+                { std::move(m_node), std::forward<Function>(function) });
+        }
+
+        // `function` takes no arguments and returns a `Maybe` of the same value type.
+        template <std::invocable Function>
+            requires dtl::lazy_maybe_like<std::invoke_result_t<Function>>
+                  && (!dtl::lazy_result_like<std::invoke_result_t<Function>>)
+                  && std::is_same_v<
+                         Value,
+                         std::remove_cvref_t<
+                             decltype(std::declval<std::invoke_result_t<Function>>()
+                                          .unwrap_unchecked())>>
+        [[nodiscard]] constexpr auto or_else(Function&& function) &&
+            -> Next<dtl::Lazy_or_else<Node, std::decay_t<Function>>>
+        {
+            return Next<dtl::Lazy_or_else<Node, std::decay_t<Function>>>(
+                { std::move(m_node), std::forward<Function>(function) });
+        }
+
+        template <class Fallback>
+            requires std::is_constructible_v<Value, Fallback&&>
+        [[nodiscard]] constexpr auto value_or(Fallback&& fallback) && -> Value
+        {
+            auto on_invoke = []<class Function, class V>(Function&& function, V&& value) -> Value {
+                return Value(std::invoke(std::forward<Function>(function), std::forward<V>(value)));
+            };
+            auto on_empty = [&] -> Value { return Value(std::forward<Fallback>(fallback)); };
+            return dtl::lazy_evaluate_invoke<Value>(m_node, on_invoke, on_empty);
+        }
+
+        [[nodiscard]] constexpr auto evaluate() && -> Maybe<Value, Unwrap_config, Deref_config>
+        {
+            using Evaluated = Maybe<Value, Unwrap_config, Deref_config>;
+            auto on_invoke  = []<class Function, class V>(Function&& function, V&& value)
+                -> Evaluated {
+                return Evaluated(
+                    in_place_invoke, std::forward<Function>(function), std::forward<V>(value));
+            };
+            auto on_empty = [] -> Evaluated { return nothing; };
+            return dtl::lazy_evaluate_invoke<Evaluated>(m_node, on_invoke, on_empty);
+        }
     };
 
 } // namespace aa
@@ -0,0 +1,459 @@
+#pragma once
+
+#include <aa/maybe.hpp>
+#include <aa/utility.hpp>
+#include <functional>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <bit>
+
+namespace aa::dtl {
+    template <sane T, sentinel_config<T> Config>
+    struct Maybe_vector_core;
+
+    // Without a sentinel value, values are stored densely in raw storage, and
+    // presence is tracked separately in a packed bitmap. Bits past `m_size` are always zero.
+    template <sane T, sentinel_config<T> Config>
+        requires std::is_void_v<decltype(Config::sentinel_value())>
+    struct Maybe_vector_core<T, Config> final {
+        using Word = std::uint64_t;
+
+        static constexpr std::size_t word_bits = std::numeric_limits<Word>::digits;
+
+        T*                m_values = nullptr;
+        std::vector<Word> m_presence;
+        std::size_t       m_size     = 0;
+        std::size_t       m_capacity = 0;
+
+        Maybe_vector_core() = default;
+
+        constexpr Maybe_vector_core(Maybe_vector_core const& other)
+            requires std::is_copy_constructible_v<T>
+            : Maybe_vector_core() // Delegate so that the destructor runs if a copy throws.
+        {
+            reserve(other.m_size);
+            for (std::size_t index = 0; index != other.m_size; ++index) {
+                if (other.has_value(index)) {
+                    emplace_back(other.m_values[index]);
+                }
+                else {
+                    push_back_empty();
+                }
+            }
+        }
+
+        constexpr Maybe_vector_core(Maybe_vector_core&& other) noexcept
+            : m_values(std::exchange(other.m_values, nullptr))
+            , m_presence(std::move(other.m_presence))
+            , m_size(std::exchange(other.m_size, 0))
+            , m_capacity(std::exchange(other.m_capacity, 0))
+        {
+            other.m_presence.clear();
+        }
+
+        constexpr auto operator=(Maybe_vector_core const& other) -> Maybe_vector_core&
+            requires std::is_copy_constructible_v<T>
+        {
+            if (this != &other) {
+                Maybe_vector_core copy { other };
+                swap(copy);
+            }
+            return *this;
+        }
+
+        constexpr auto operator=(Maybe_vector_core&& other) noexcept -> Maybe_vector_core&
+        {
+            if (this != &other) {
+                Maybe_vector_core moved { std::move(other) };
+                swap(moved);
+            }
+            return *this;
+        }
+
+        constexpr ~Maybe_vector_core()
+        {
+            clear();
+            if (m_values != nullptr) {
+                std::allocator<T> {}.deallocate(m_values, m_capacity);
+            }
+        }
+
+        constexpr auto swap(Maybe_vector_core& other) noexcept -> void
+        {
+            std::swap(m_values, other.m_values);
+            std::swap(m_presence, other.m_presence);
+            std::swap(m_size, other.m_size);
+            std::swap(m_capacity, other.m_capacity);
+        }
+
+        [[nodiscard]] static constexpr auto word_count(std::size_t const bits) noexcept
+            -> std::size_t
+        {
+            return (bits + word_bits - 1) / word_bits;
+        }
+
+        [[nodiscard]] static constexpr auto bit(std::size_t const index) noexcept -> Word
+        {
+            return Word { 1 } << (index % word_bits);
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return m_size;
+        }
+
+        [[nodiscard]] constexpr auto has_value(std::size_t const index) const noexcept -> bool
+        {
+            return (m_presence[index / word_bits] & bit(index)) != 0;
+        }
+
+        [[nodiscard]] constexpr auto value(std::size_t const index) noexcept -> T&
+        {
+            return m_values[index];
+        }
+
+        [[nodiscard]] constexpr auto value(std::size_t const index) const noexcept -> T const&
+        {
+            return m_values[index];
+        }
+
+        constexpr auto reserve(std::size_t const capacity) -> void
+        {
+            if (capacity <= m_capacity) {
+                return;
+            }
+            // Both of these may throw, but neither modifies any observable state.
+            m_presence.resize(word_count(capacity));
+            T* const values = std::allocator<T> {}.allocate(capacity);
+
+            for_each_present([&](std::size_t const index, T& value) noexcept {
+                std::construct_at(values + index, std::move(value));
+                std::destroy_at(std::addressof(value));
+            });
+            if (m_values != nullptr) {
+                std::allocator<T> {}.deallocate(m_values, m_capacity);
+            }
+            m_values   = values;
+            m_capacity = capacity;
+        }
+
+        constexpr auto grow_if_full() -> void
+        {
+            if (m_size == m_capacity) {
+                reserve(m_capacity == 0 ? 8 : m_capacity * 2);
+            }
+        }
+
+        template <class... Args>
+        constexpr auto emplace_back(Args&&... args) -> T&
+        {
+            grow_if_full();
+            T& value = *std::construct_at(m_values + m_size, std::forward<Args>(args)...);
+            m_presence[m_size / word_bits] |= bit(m_size);
+            ++m_size;
+            return value;
+        }
+
+        constexpr auto push_back_empty() -> void
+        {
+            grow_if_full();
+            ++m_size;
+        }
+
+        constexpr auto pop_back() noexcept -> void
+        {
+            reset(--m_size);
+        }
+
+        template <class... Args>
+        constexpr auto emplace(std::size_t const index, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>) -> T&
+        {
+            reset(index);
+            T& value = *std::construct_at(m_values + index, std::forward<Args>(args)...);
+            m_presence[index / word_bits] |= bit(index);
+            return value;
+        }
+
+        constexpr auto reset(std::size_t const index) noexcept -> void
+        {
+            if (has_value(index)) {
+                std::destroy_at(m_values + index);
+                m_presence[index / word_bits] &= ~bit(index);
+            }
+        }
+
+        constexpr auto clear() noexcept -> void
+        {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for_each_present(
+                    [](std::size_t, T& value) noexcept { std::destroy_at(std::addressof(value)); });
+            }
+            std::ranges::fill(m_presence, Word {});
+            m_size = 0;
+        }
+
+        [[nodiscard]] constexpr auto count() const noexcept -> std::size_t
+        {
+            std::size_t count = 0;
+            for (std::size_t word = 0; word != word_count(m_size); ++word) {
+                count += static_cast<std::size_t>(std::popcount(m_presence[word]));
+            }
+            return count;
+        }
+
+        [[nodiscard]] constexpr auto find_next_present(std::size_t const from) const noexcept
+            -> Maybe<std::size_t>
+        {
+            if (from >= m_size) {
+                return nothing;
+            }
+            std::size_t const words = word_count(m_size);
+            std::size_t       word  = from / word_bits;
+            Word              bits  = m_presence[word] & ~(bit(from) - 1);
+            while (bits == 0) {
+                if (++word == words) {
+                    return nothing;
+                }
+                bits = m_presence[word];
+            }
+            return word * word_bits + static_cast<std::size_t>(std::countr_zero(bits));
+        }
+
+        template <class Self, class Function>
+        constexpr auto for_each_present(this Self& self, Function&& function) -> void
+        {
+            for (std::size_t word = 0; word != word_count(self.m_size); ++word) {
+                for (Word bits = self.m_presence[word]; bits != 0; bits &= bits - 1) {
+                    std::size_t const index
+                        = word * word_bits + static_cast<std::size_t>(std::countr_zero(bits));
+                    std::invoke(function, index, self.m_values[index]);
+                }
+            }
+        }
+    };
+
+    // With a sentinel value, no bitmap is needed: empty slots simply hold the sentinel.
+    template <sane T, sentinel_config<T> Config>
+        requires std::is_same_v<T, decltype(Config::sentinel_value())>
+    struct Maybe_vector_core<T, Config> final {
+        std::vector<T> m_values;
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return m_values.size();
+        }
+
+        [[nodiscard]] constexpr auto has_value(std::size_t const index) const
+            noexcept(noexcept(Config::is_sentinel_value(m_values[index]))) -> bool
+        {
+            return !Config::is_sentinel_value(m_values[index]);
+        }
+
+        [[nodiscard]] constexpr auto value(std::size_t const index) noexcept -> T&
+        {
+            return m_values[index];
+        }
+
+        [[nodiscard]] constexpr auto value(std::size_t const index) const noexcept -> T const&
+        {
+            return m_values[index];
+        }
+
+        constexpr auto reserve(std::size_t const capacity) -> void
+        {
+            m_values.reserve(capacity);
+        }
+
+        template <class... Args>
+        constexpr auto emplace_back(Args&&... args) -> T&
+        {
+            return m_values.emplace_back(std::forward<Args>(args)...);
+        }
+
+        constexpr auto push_back_empty() -> void
+        {
+            m_values.push_back(Config::sentinel_value());
+        }
+
+        constexpr auto pop_back() noexcept -> void
+        {
+            m_values.pop_back();
+        }
+
+        template <class... Args>
+        constexpr auto emplace(std::size_t const index, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>) -> T&
+        {
+            move_assign(m_values[index], T(std::forward<Args>(args)...));
+            return m_values[index];
+        }
+
+        constexpr auto reset(std::size_t const index) noexcept -> void
+        {
+            move_assign(m_values[index], Config::sentinel_value());
+        }
+
+        constexpr auto clear() noexcept -> void
+        {
+            m_values.clear();
+        }
+
+        [[nodiscard]] constexpr auto count() const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(std::ranges::count_if(
+                m_values, [](T const& value) { return !Config::is_sentinel_value(value); }));
+        }
+
+        [[nodiscard]] constexpr auto find_next_present(std::size_t const from) const noexcept
+            -> Maybe<std::size_t>
+        {
+            for (std::size_t index = from; index < m_values.size(); ++index) {
+                if (has_value(index)) {
+                    return index;
+                }
+            }
+            return nothing;
+        }
+
+        template <class Self, class Function>
+        constexpr auto for_each_present(this Self& self, Function&& function) -> void
+        {
+            for (std::size_t index = 0; index != self.m_values.size(); ++index) {
+                if (self.has_value(index)) {
+                    std::invoke(function, index, self.m_values[index]);
+                }
+            }
+        }
+    };
+} // namespace aa::dtl
+
+namespace aa {
+
+    // Struct-of-arrays alternative to `std::vector<Maybe<T>>`. Values are stored densely,
+    // and presence is tracked in a packed bitmap unless `T` has a sentinel value.
+    template <
+        sane               T,
+        access_config      Unwrap_config   = Access_config_checked,
+        access_config      Deref_config    = Access_config_checked,
+        sentinel_config<T> Sentinel_config = Sentinel_config_default_for<T>>
+    class Maybe_vector final {
+        dtl::Maybe_vector_core<T, Sentinel_config> m_core;
+    public:
+        Maybe_vector() = default;
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return m_core.size();
+        }
+
+        [[nodiscard]] constexpr auto is_empty() const noexcept -> bool
+        {
+            return size() == 0;
+        }
+
+        constexpr auto reserve(std::size_t const capacity) -> void
+            requires std::is_move_constructible_v<T>
+        {
+            m_core.reserve(capacity);
+        }
+
+        template <class... Args>
+        constexpr auto emplace_back(Args&&... args) -> T&
+            requires std::is_constructible_v<T, Args&&...>
+        {
+            return m_core.emplace_back(std::forward<Args>(args)...);
+        }
+
+        constexpr auto push_back(Nothing) -> void
+        {
+            m_core.push_back_empty();
+        }
+
+        template <class Arg = T>
+            requires(!tag_type<std::remove_cvref_t<Arg>>) && std::is_constructible_v<T, Arg&&>
+        constexpr auto push_back(Arg&& arg) -> T&
+        {
+            return m_core.emplace_back(std::forward<Arg>(arg));
+        }
+
+        // Precondition: `!is_empty()`
+        constexpr auto pop_back() noexcept -> void
+        {
+            m_core.pop_back();
+        }
+
+        constexpr auto clear() noexcept -> void
+        {
+            m_core.clear();
+        }
+
+        // Precondition: `index < size()`
+        [[nodiscard]] constexpr auto has_value(std::size_t const index) const noexcept -> bool
+        {
+            return m_core.has_value(index);
+        }
+
+        // Precondition: `index < size()`
+        [[nodiscard]] constexpr auto operator[](std::size_t const index) noexcept
+            -> Maybe<Ref<T>, Unwrap_config, Deref_config>
+        {
+            if (has_value(index)) {
+                return Ref { m_core.value(index) };
+            }
+            return nothing;
+        }
+
+        // Precondition: `index < size()`
+        [[nodiscard]] constexpr auto operator[](std::size_t const index) const noexcept
+            -> Maybe<Ref<T const>, Unwrap_config, Deref_config>
+        {
+            if (has_value(index)) {
+                return Ref { m_core.value(index) };
+            }
+            return nothing;
+        }
+
+        // Precondition: `index < size()`
+        template <class... Args>
+        constexpr auto emplace(std::size_t const index, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>) -> T&
+            requires std::is_constructible_v<T, Args&&...>
+        {
+            return m_core.emplace(index, std::forward<Args>(args)...);
+        }
+
+        // Precondition: `index < size()`
+        constexpr auto reset(std::size_t const index) noexcept -> void
+        {
+            m_core.reset(index);
+        }
+
+        // Number of present values.
+        [[nodiscard]] constexpr auto count() const noexcept -> std::size_t
+        {
+            return m_core.count();
+        }
+
+        // Index of the first present value at or after `from`, if any.
+        [[nodiscard]] constexpr auto find_next_present(std::size_t const from = 0) const noexcept
+            -> Maybe<std::size_t>
+        {
+            return m_core.find_next_present(from);
+        }
+
+        // Invoke `function(index, value)` for each present value, in index order.
+        template <class Self, std::invocable<std::size_t, Qualified_like<Self&, T>> Function>
+        constexpr auto for_each_present(this Self& self, Function&& function) -> void
+        {
+            self.m_core.for_each_present(std::forward<Function>(function));
+        }
+    };
+
+} // namespace aa
+
+namespace aa::inline basics {
+    using aa::Maybe_vector;
+}
@@ -1,6 +1,13 @@
 #pragma once
 
 #include <aa/utility.hpp>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <array>
+
+// The algorithms on lists are implemented with pack expansions, bounded folds and constant
+// expression loops instead of recursion, so that instantiating them over long lists stays cheap.
 
 namespace aa::meta {
 
@@ -29,3 +36,179 @@ namespace aa::meta {
     struct Satisfies_all_of : std::conjunction<Traits<T>...> {};
 
 } // namespace aa::meta
+
+namespace aa::meta::dtl {
+
+    template <class... Ts>
+    struct Concat_operand {};
+
+    template <class... As, class... Bs>
+    auto operator+(Concat_operand<As...>, Concat_operand<Bs...>) -> Concat_operand<As..., Bs...>;
+
+    // Concatenate by folding `+` over the operands. A fold nests as deeply as it has operands, so
+    // it is only used for batches of at most `concat_batch_size` operands.
+    template <class... Operands>
+    using Concat_fold = decltype((Concat_operand<> {} + ... + Operands {}));
+
+    inline constexpr std::size_t concat_batch_size = 128;
+
+    template <class>
+    struct Concat_result;
+    template <class... Ts>
+    struct Concat_result<Concat_operand<Ts...>> : std::type_identity<List<Ts...>> {};
+
+    // The index of the first occurrence of `T` in `Ts`, or `sizeof...(Ts)`.
+    template <class T, class... Ts>
+    consteval auto index_of() noexcept -> std::size_t
+    {
+        constexpr bool matches[] { std::is_same_v<T, Ts>..., true }; // NOLINT: C array
+        std::size_t    index = 0;
+        while (!matches[index]) {
+            ++index;
+        }
+        return index;
+    }
+
+    // A distinct address for each type, so that types can be compared in a constant expression
+    // loop, instead of instantiating a trait for each pair of types.
+    template <class T>
+    inline constexpr char type_tag {};
+
+    // Whether each element is the first occurrence of its type.
+    template <class... Ts>
+    consteval auto first_occurrences() noexcept -> std::array<bool, sizeof...(Ts)>
+    {
+        constexpr char const* tags[] { &type_tag<Ts>..., nullptr }; // NOLINT: C array
+        std::array<bool, sizeof...(Ts)> first {};
+        for (std::size_t index = 0; index != sizeof...(Ts); ++index) {
+            std::size_t other = 0;
+            while (tags[other] != tags[index]) {
+                ++other;
+            }
+            first[index] = other == index;
+        }
+        return first;
+    }
+
+    template <class>
+    inline constexpr std::array<bool, 0> first_occurrences_in {};
+    template <class... Ts>
+    inline constexpr auto first_occurrences_in<List<Ts...>> = first_occurrences<Ts...>();
+
+    template <std::size_t index, class T>
+    struct Indexed {};
+
+    template <class, class...>
+    struct Indexed_pack;
+    template <std::size_t... indices, class... Ts>
+    struct Indexed_pack<std::index_sequence<indices...>, Ts...> : Indexed<indices, Ts>... {};
+
+    // Overload resolution deduces `T` from the only base with the requested index.
+    template <std::size_t index, class T>
+    auto select(Indexed<index, T> const&) -> std::type_identity<T>;
+
+} // namespace aa::meta::dtl
+
+namespace aa::meta {
+
+    template <class T, list>
+    struct Contains;
+    template <class T, class... Ts>
+    struct Contains<T, List<Ts...>>
+        : std::bool_constant<dtl::index_of<T, Ts...>() != sizeof...(Ts)> {};
+
+    // The index of the first occurrence of `T`.
+    template <class T, list>
+    struct Index_of;
+    template <class T, class... Ts>
+        requires Contains<T, List<Ts...>>::value
+    struct Index_of<T, List<Ts...>>
+        : std::integral_constant<std::size_t, dtl::index_of<T, Ts...>()> {};
+
+    template <std::size_t index, list>
+    struct At;
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define AA_META_TYPE_PACK_ELEMENT
+#endif
+#endif
+#if defined(AA_META_TYPE_PACK_ELEMENT)
+    template <std::size_t index, class... Ts>
+        requires(index < sizeof...(Ts))
+    struct At<index, List<Ts...>> : std::type_identity<__type_pack_element<index, Ts...>> {};
+#else
+    template <std::size_t index, class... Ts>
+        requires(index < sizeof...(Ts))
+    struct At<index, List<Ts...>>
+        : decltype(dtl::select<index>(
+              dtl::Indexed_pack<std::index_sequence_for<Ts...>, Ts...> {})) {};
+#endif
+#undef AA_META_TYPE_PACK_ELEMENT
+
+} // namespace aa::meta
+
+namespace aa::meta::dtl {
+
+    template <std::size_t offset, class Operands, class>
+    struct Concat_batch;
+    template <std::size_t offset, class Operands, std::size_t... indices>
+    struct Concat_batch<offset, Operands, std::index_sequence<indices...>>
+        : std::type_identity<Concat_fold<typename At<offset + indices, Operands>::type...>> {};
+
+    // The concatenation of the batch of operands that starts at `offset`.
+    template <std::size_t offset, class... Operands>
+    using Concat_batch_at = typename Concat_batch<
+        offset,
+        List<Operands...>,
+        std::make_index_sequence<std::min(concat_batch_size, sizeof...(Operands) - offset)>>::type;
+
+    template <class, class...>
+    struct Concat_batches;
+    template <std::size_t... batches, class... Operands>
+    struct Concat_batches<std::index_sequence<batches...>, Operands...>
+        : std::type_identity<
+              Concat_fold<Concat_batch_at<batches * concat_batch_size, Operands...>...>> {};
+
+    // Concatenate in batches, and then concatenate the batches, so that neither fold has more
+    // than `concat_batch_size` operands for up to `concat_batch_size` squared operands.
+    template <class... Operands>
+    using Concat_all = typename Concat_batches<
+        std::make_index_sequence<(sizeof...(Operands) + concat_batch_size - 1) / concat_batch_size>,
+        Operands...>::type;
+
+    // `Ts` is `Whole` as a pack, which keeps `Whole` out of the expansion over `Ts`.
+    template <class Whole, class, class... Ts>
+    struct Unique;
+    template <class Whole, std::size_t... indices, class... Ts>
+    struct Unique<Whole, std::index_sequence<indices...>, Ts...>
+        : Concat_result<Concat_all<std::conditional_t<
+              first_occurrences_in<Whole>[indices],
+              Concat_operand<Ts>,
+              Concat_operand<>>...>> {};
+
+} // namespace aa::meta::dtl
+
+namespace aa::meta {
+
+    template <list... Lists>
+    struct Concat : dtl::Concat_result<dtl::Concat_all<
+                        typename Apply<dtl::Concat_operand, Lists>::type...>> {};
+
+    // The elements that satisfy `Predicate`, in order.
+    template <template <class...> class Predicate, list>
+    struct Filter;
+    template <template <class...> class Predicate, class... Ts>
+    struct Filter<Predicate, List<Ts...>>
+        : dtl::Concat_result<dtl::Concat_all<std::conditional_t<
+              Predicate<Ts>::value,
+              dtl::Concat_operand<Ts>,
+              dtl::Concat_operand<>>...>> {};
+
+    // The first occurrence of each element, in order.
+    template <list>
+    struct Unique;
+    template <class... Ts>
+    struct Unique<List<Ts...>>
+        : dtl::Unique<List<Ts...>, std::index_sequence_for<Ts...>, Ts...> {};
+
+} // namespace aa::meta
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <aa/lazy.hpp>
+#include <aa/utility.hpp>
+#include <functional>
+#include <atomic>
+#include <new>
+
+namespace aa::dtl {
+
+    // Selects the flag-based `Maybe_core` even for types with a default sentinel, since the flag
+    // is what publishes the value to other threads.
+    template <class T>
+    struct Once_sentinel_config final {
+        Once_sentinel_config() = delete;
+        // Not implemented
+        static auto sentinel_value() noexcept -> void;
+        // Not implemented
+        static auto is_sentinel_value(T const&) noexcept -> bool;
+    };
+
+    template <class Function>
+    using Once_try_result = std::invoke_result_t<Function&&>;
+
+    template <class Function>
+    using Once_try_value = decltype(std::declval<Once_try_result<Function>>().unwrap_unchecked());
+
+    template <class Function>
+    using Once_try_error = std::remove_cvref_t<
+        decltype(std::declval<Once_try_result<Function>>().unwrap_err_unchecked())>;
+
+} // namespace aa::dtl
+
+namespace aa {
+
+    // A value that is initialized on first use, at most once, even if several threads use it at
+    // the same time. Once initialized, an access is a single acquire load of the presence flag of
+    // the storage, with no function call. If initialization fails, by throwing or by returning an
+    // error, the cell stays empty, and the next access tries again.
+    template <sane T>
+    class Once final {
+        // Mutable, so that const accesses can load the presence flag atomically.
+        mutable dtl::Maybe_core<T, dtl::Once_sentinel_config<T>> m_core;
+
+        // Held by the thread that is initializing. The others wait on it.
+        bool m_initializing = false;
+
+        // Only the initializing thread writes the flag, and only by a release store, after the
+        // value is constructed. Accessed directly in constant evaluation.
+        [[nodiscard]] constexpr auto is_ready() const noexcept -> bool
+        {
+            if consteval {
+                return m_core.m_has_value;
+            }
+            return std::atomic_ref<bool>(m_core.m_has_value).load(std::memory_order_acquire);
+        }
+
+        // Whether the value is initialized, for the thread that holds the initialization lock,
+        // whose acquire already synchronizes with the release of the flag.
+        [[nodiscard]] auto is_ready_locked() const noexcept -> bool
+        {
+            return std::atomic_ref<bool>(m_core.m_has_value).load(std::memory_order_relaxed);
+        }
+
+        // Held by the thread that initializes, so that the others wait for it instead of
+        // initializing too. Released by the destructor, also when initialization throws.
+        class Initialization_lock final {
+            bool& m_initializing;
+        public:
+            explicit Initialization_lock(Once& once) noexcept
+                : m_initializing { once.m_initializing }
+            {
+                std::atomic_ref<bool> const initializing(m_initializing);
+                while (initializing.exchange(true, std::memory_order_acquire)) {
+                    initializing.wait(true, std::memory_order_relaxed);
+                }
+            }
+
+            Initialization_lock(Initialization_lock const&)                    = delete;
+            auto operator=(Initialization_lock const&) -> Initialization_lock& = delete;
+
+            ~Initialization_lock()
+            {
+                std::atomic_ref<bool> const initializing(m_initializing);
+                initializing.store(false, std::memory_order_release);
+                initializing.notify_one();
+            }
+        };
+
+        auto publish() noexcept -> void
+        {
+            std::atomic_ref<bool>(m_core.m_has_value).store(true, std::memory_order_release);
+        }
+
+        template <class Function>
+        auto initialize(Function&& function) -> void
+        {
+            Initialization_lock const lock { *this };
+            if (!is_ready_locked()) {
+                // Unlike `std::construct_at`, placement new elides the result of `function`.
+                ::new (static_cast<void*>(std::addressof(m_core.m_value))) // NOLINT: union access
+                    T(std::invoke(std::forward<Function>(function)));
+                publish();
+            }
+        }
+
+        // Returns the error of `function`, if it was called and failed.
+        template <class Function>
+        auto try_initialize(Function&& function) -> Maybe<dtl::Once_try_error<Function>>
+        {
+            Initialization_lock const lock { *this };
+            if (!is_ready_locked()) {
+                auto result = std::invoke(std::forward<Function>(function));
+                if (!result.has_value()) {
+                    return std::move(result).unwrap_err_unchecked();
+                }
+                std::construct_at(
+                    std::addressof(m_core.m_value), // NOLINT: union access
+                    std::move(result).unwrap_unchecked());
+                publish();
+            }
+            return nothing;
+        }
+    public:
+        constexpr Once() noexcept = default;
+
+        Once(Once const&)                    = delete;
+        auto operator=(Once const&) -> Once& = delete;
+
+        // The value, if it has been initialized.
+        [[nodiscard]] constexpr auto get() const noexcept -> Maybe<Ref<T const>>
+        {
+            if (is_ready()) {
+                return Ref<T const>(m_core.m_value);
+            }
+            return nothing;
+        }
+
+        // The value, which is initialized with the result of `function` if it has not been.
+        // Concurrent callers wait until it is. If `function` throws, the cell stays empty.
+        template <class Function>
+            requires std::is_invocable_r_v<T, Function&&>
+        constexpr auto get_or_init(Function&& function) -> T&
+        {
+            if consteval {
+                // There is only one thread, and the core's constructor elides the result too.
+                if (!m_core.m_has_value) {
+                    std::destroy_at(std::addressof(m_core));
+                    std::construct_at(
+                        std::addressof(m_core), in_place_invoke, std::forward<Function>(function));
+                }
+            }
+            else {
+                if (!is_ready()) {
+                    initialize(std::forward<Function>(function));
+                }
+            }
+            return m_core.m_value;
+        }
+
+        // The value, which is initialized with the value of the `Result` that `function` returns
+        // if it has not been. If `function` returns an error, it is returned, and the cell stays
+        // empty, so the next access tries again.
+        template <class Function>
+            requires dtl::lazy_result_like<dtl::Once_try_result<Function>>
+                  && std::is_constructible_v<T, dtl::Once_try_value<Function>>
+        constexpr auto get_or_try_init(Function&& function)
+            -> Result<Ref<T>, dtl::Once_try_error<Function>>
+        {
+            if consteval {
+                if (!m_core.m_has_value) {
+                    auto result = std::invoke(std::forward<Function>(function));
+                    if (!result.has_value()) {
+                        return Error { std::move(result).unwrap_err_unchecked() };
+                    }
+                    std::destroy_at(std::addressof(m_core));
+                    std::construct_at(
+                        std::addressof(m_core), in_place, std::move(result).unwrap_unchecked());
+                }
+            }
+            else {
+                if (!is_ready()) {
+                    auto error = try_initialize(std::forward<Function>(function));
+                    if (error.has_value()) {
+                        return Error { std::move(error).unwrap_unchecked() };
+                    }
+                }
+            }
+            return Ref<T>(m_core.m_value);
+        }
+    };
+
+} // namespace aa
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <aa/utility.hpp>
+#include <aa/meta.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <array>
+#include <tuple>
+
+namespace aa::meta::dtl {
+
+    // The index in `Ts` of the member in each slot: decreasing alignment, then decreasing size,
+    // then increasing index. Every size is a multiple of its alignment, so each member starts at
+    // an offset that is already aligned for it, and only the end of the record can be padded.
+    template <class... Ts>
+    consteval auto make_layout_order() noexcept -> std::array<std::size_t, sizeof...(Ts)>
+    {
+        constexpr std::size_t alignments[] { alignof(Ts)..., 0 }; // NOLINT: C array
+        constexpr std::size_t sizes[] { sizeof(Ts)..., 0 };       // NOLINT: C array
+
+        std::array<std::size_t, sizeof...(Ts)> order {};
+        for (std::size_t index = 0; index != order.size(); ++index) {
+            order[index] = index;
+        }
+        std::ranges::sort(order, [&](std::size_t const a, std::size_t const b) {
+            if (alignments[a] != alignments[b]) {
+                return alignments[a] > alignments[b];
+            }
+            if (sizes[a] != sizes[b]) {
+                return sizes[a] > sizes[b];
+            }
+            return a < b;
+        });
+        return order;
+    }
+
+    template <class... Ts>
+    inline constexpr auto layout_order = make_layout_order<Ts...>();
+
+    // The slot of each member, the inverse of `layout_order`.
+    template <class... Ts>
+    inline constexpr auto layout_slots = [] {
+        std::array<std::size_t, sizeof...(Ts)> slots {};
+        for (std::size_t slot = 0; slot != slots.size(); ++slot) {
+            slots[layout_order<Ts...>[slot]] = slot;
+        }
+        return slots;
+    }();
+
+    template <std::size_t slot, class T>
+    struct Layout_member {
+        T value {};
+
+        Layout_member() = default;
+
+        template <class Arg>
+        explicit constexpr Layout_member(In_place, Arg&& arg) : value(std::forward<Arg>(arg))
+        {}
+    };
+
+    template <std::size_t slot, class T>
+        requires std::is_empty_v<T>
+    struct Layout_member<slot, T> {
+        [[no_unique_address]] T value {};
+
+        Layout_member() = default;
+
+        template <class Arg>
+        explicit constexpr Layout_member(In_place, Arg&& arg) : value(std::forward<Arg>(arg))
+        {}
+    };
+
+    template <class, class>
+    struct Layout_storage;
+
+    // The bases are laid out in slot order.
+    template <class... Ts, std::size_t... slots>
+    struct Layout_storage<List<Ts...>, std::index_sequence<slots...>>
+        : Layout_member<slots, typename At<layout_order<Ts...>[slots], List<Ts...>>::type>... {
+
+        Layout_storage() = default;
+
+        // `args` holds references to the constructor arguments, in member order.
+        template <class Args>
+        explicit constexpr Layout_storage(In_place, Args&& args)
+            : Layout_member<slots, typename At<layout_order<Ts...>[slots], List<Ts...>>::type> {
+                in_place, std::get<layout_order<Ts...>[slots]>(std::move(args))
+            }...
+        {}
+    };
+
+} // namespace aa::meta::dtl
+
+namespace aa::meta {
+
+    // A record of the types in `Members`, stored in the order that needs the least padding. The
+    // members are accessed by their index in `Members`. Trivially copyable if every member is.
+    template <list Members>
+    class Optimal_layout;
+
+    template <class... Ts>
+    class Optimal_layout<List<Ts...>> final {
+        dtl::Layout_storage<List<Ts...>, std::index_sequence_for<Ts...>> m_storage;
+    public:
+        Optimal_layout() = default;
+
+        template <class... Args>
+            requires(sizeof...(Args) == sizeof...(Ts) && sizeof...(Ts) != 0)
+                 && (std::is_constructible_v<Ts, Args &&> && ...)
+        explicit constexpr Optimal_layout(Args&&... args)
+            : m_storage { in_place, std::forward_as_tuple(std::forward<Args>(args)...) }
+        {}
+
+        // The position of the member at `index` in the physical order.
+        [[nodiscard]] static constexpr auto slot(std::size_t const index) noexcept -> std::size_t
+        {
+            return dtl::layout_slots<Ts...>[index];
+        }
+
+        template <std::size_t index, class Self>
+            requires(index < sizeof...(Ts))
+        [[nodiscard]] constexpr auto get(this Self&& self) noexcept
+            -> Qualified_like<Self, typename At<index, List<Ts...>>::type>
+        {
+            using Member = dtl::Layout_member<slot(index), typename At<index, List<Ts...>>::type>;
+            auto&& member = static_cast<Qualified_like<Self, Member>>(self.m_storage);
+            return std::forward_like<Self>(member.value);
+        }
+    };
+
+} // namespace aa::meta
+
+// Structured bindings use the member `get`.
+
+template <class... Ts>
+struct std::tuple_size<aa::meta::Optimal_layout<aa::meta::List<Ts...>>>
+    : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template <std::size_t index, class... Ts>
+struct std::tuple_element<index, aa::meta::Optimal_layout<aa::meta::List<Ts...>>>
+    : aa::meta::At<index, aa::meta::List<Ts...>> {};
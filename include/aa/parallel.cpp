@@ -0,0 +1,112 @@
+#include <aa/parallel.hpp>
+#include <condition_variable>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+namespace {
+
+    // One call to `parallel_run`. Lives on the stack of the calling thread.
+    struct Job {
+        aa::dtl::Chunk_job       function {};
+        void*                    context {};
+        std::size_t              chunk_count {};
+        std::atomic<std::size_t> next_chunk { 0 };
+        std::size_t              helpers {}; // Workers that have joined. Guarded by the pool mutex.
+    };
+
+    // Claim chunks until none are left.
+    auto work_on(Job& job) noexcept -> void
+    {
+        for (;;) {
+            std::size_t const chunk = job.next_chunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= job.chunk_count) {
+                return;
+            }
+            job.function(job.context, chunk);
+        }
+    }
+
+    // Each queued entry invites one worker to join a job. The invitations that no worker has taken
+    // by the time the calling thread runs out of chunks are withdrawn.
+    struct Pool {
+        std::mutex              mutex;
+        std::condition_variable work_available;
+        std::condition_variable helper_done;
+        std::deque<Job*>        invitations;
+        std::size_t             worker_count {};
+
+        [[noreturn]] auto run_worker() noexcept -> void
+        {
+            std::unique_lock lock { mutex };
+            for (;;) {
+                work_available.wait(lock, [&] { return !invitations.empty(); });
+                Job& job = *invitations.front();
+                invitations.pop_front();
+                ++job.helpers;
+
+                lock.unlock();
+                work_on(job);
+                lock.lock();
+
+                if (--job.helpers == 0) {
+                    helper_done.notify_all();
+                }
+            }
+        }
+
+        // Start workers until there are `count`. They run until the process exits.
+        auto grow(std::size_t const count) -> void
+        {
+            for (; worker_count < count; ++worker_count) {
+                std::thread { [this] { run_worker(); } }.detach();
+            }
+        }
+    };
+
+    // Leaked, so that the workers never outlive it.
+    auto pool() -> Pool&
+    {
+        static Pool* const instance = new Pool; // NOLINT: intentionally leaked
+        return *instance;
+    }
+
+} // namespace
+
+auto aa::dtl::hardware_thread_count() noexcept -> std::size_t
+{
+    return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+auto aa::dtl::parallel_run(
+    std::size_t const chunk_count,
+    std::size_t const thread_count,
+    Chunk_job const   job,
+    void* const       context) -> void
+{
+    std::size_t const participants = std::min(thread_count, chunk_count);
+    if (participants <= 1) {
+        for (std::size_t chunk = 0; chunk != chunk_count; ++chunk) {
+            job(context, chunk);
+        }
+        return;
+    }
+    std::size_t const helpers = participants - 1;
+
+    Job   shared { .function = job, .context = context, .chunk_count = chunk_count };
+    Pool& pool = ::pool();
+    {
+        std::lock_guard const lock { pool.mutex };
+        pool.grow(helpers);
+        pool.invitations.insert(pool.invitations.end(), helpers, &shared);
+    }
+    pool.work_available.notify_all();
+
+    work_on(shared);
+
+    std::unique_lock lock { pool.mutex };
+    std::erase(pool.invitations, &shared);
+    pool.helper_done.wait(lock, [&] { return shared.helpers == 0; });
+}
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <aa/lazy.hpp>
+#include <aa/utility.hpp>
+#include <functional>
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <cstddef>
+#include <ranges>
+#include <atomic>
+#include <vector>
+
+namespace aa {
+
+    struct Parallel_options {
+        // The number of threads, including the calling thread. Zero means one per hardware thread.
+        std::size_t thread_count {};
+
+        // The number of elements per chunk. Zero means a few chunks per thread.
+        std::size_t chunk_size {};
+    };
+
+} // namespace aa
+
+namespace aa::dtl {
+
+    using Chunk_job = auto (*)(void* context, std::size_t chunk) noexcept -> void;
+
+    // Invoke `job(context, chunk)` once for each chunk in `[0, chunk_count)`, on the calling thread
+    // and at most `thread_count - 1` workers of a process-wide pool, which is started on first use
+    // and grown on demand. Returns once every chunk has finished. A job may call `parallel_run`
+    // again, since the calling thread always takes part.
+    auto parallel_run(
+        std::size_t chunk_count, std::size_t thread_count, Chunk_job job, void* context) -> void;
+
+    [[nodiscard]] auto hardware_thread_count() noexcept -> std::size_t;
+
+    template <class Transform, class R>
+    concept result_transform = std::ranges::random_access_range<R> && std::ranges::sized_range<R>
+                            && std::invocable<Transform const&, std::ranges::range_reference_t<R>>
+                            && lazy_result_like<std::invoke_result_t<
+                                   Transform const&,
+                                   std::ranges::range_reference_t<R>>>;
+
+    template <class Transform, class R>
+    using Transform_result
+        = std::invoke_result_t<Transform const&, std::ranges::range_reference_t<R>>;
+
+    template <class Transform, class R>
+    using Transform_value
+        = std::remove_cvref_t<decltype(std::declval<Transform_result<Transform, R>>()
+                                           .unwrap_unchecked())>;
+
+    template <class Transform, class R>
+    using Transform_error
+        = std::remove_cvref_t<decltype(std::declval<Transform_result<Transform, R>>()
+                                           .unwrap_err_unchecked())>;
+
+    struct No_state {};
+
+    // The free `swap` of `std::exception_ptr` is not noexcept in libstdc++, so it is not `sane`,
+    // and cannot be stored in a `Maybe` directly.
+    struct Chunk_exception {
+        std::exception_ptr pointer;
+
+        friend auto swap(Chunk_exception& a, Chunk_exception& b) noexcept -> void
+        {
+            a.pointer.swap(b.pointer);
+        }
+    };
+
+    // Each chunk is written by one thread, so chunks are kept on separate cache lines.
+    template <class State, class E>
+    struct alignas(64) Try_chunk {
+        State                  state {};
+        Maybe<E>               error;
+        Maybe<Chunk_exception> exception; // `std::exception_ptr` is not a literal type.
+    };
+
+    // Invoke `transform` on each element of `range`, in chunks that run in parallel, and pass each
+    // value to `consume(state, position, value)` with the state of its chunk. A chunk stops at its
+    // first error or exception, and a failure cancels every element after it, so the elements
+    // before the first failure are all consumed, and the failure is the same as in a serial loop.
+    // The chunks are returned in order, or the first error, or the first exception is rethrown.
+    // Constant evaluation uses a single chunk.
+    template <class State, class R, class Transform, class Consume>
+        requires result_transform<Transform, R>
+    constexpr auto try_for_each_chunk(
+        R&                     range,
+        Transform const&       transform,
+        Consume const&         consume,
+        Parallel_options const options)
+        -> Result<std::vector<Try_chunk<State, Transform_error<Transform, R>>>,
+                  Transform_error<Transform, R>>
+    {
+        using Chunk = Try_chunk<State, Transform_error<Transform, R>>;
+
+        // More chunks than threads, so that uneven chunks balance out.
+        constexpr std::size_t chunks_per_thread = 8;
+
+        std::size_t const size       = std::ranges::size(range);
+        std::size_t       thread_cap = 1;
+        std::size_t       chunk_size = std::max<std::size_t>(size, 1);
+        if !consteval {
+            thread_cap = options.thread_count != 0 ? options.thread_count : hardware_thread_count();
+            std::size_t const target = thread_cap * chunks_per_thread;
+            chunk_size               = options.chunk_size != 0
+                                         ? options.chunk_size
+                                         : std::max<std::size_t>((size + target - 1) / target, 1);
+        }
+        std::size_t const chunk_count = (size + chunk_size - 1) / chunk_size;
+        std::vector<Chunk> chunks(chunk_count);
+
+        // `first_failure` is null in constant evaluation, where there is one chunk.
+        auto const run_chunk = [&](std::size_t const chunk,
+                                   std::atomic<std::size_t>* const first_failure) noexcept {
+            auto const fail = [&](std::size_t const position) noexcept {
+                if (first_failure != nullptr) {
+                    std::size_t known = first_failure->load(std::memory_order_relaxed);
+                    while (position < known
+                           && !first_failure->compare_exchange_weak(
+                               known, position, std::memory_order_relaxed))
+                    {}
+                }
+            };
+            Chunk&            current = chunks[chunk];
+            std::size_t const end     = std::min(size, (chunk + 1) * chunk_size);
+            for (std::size_t position = chunk * chunk_size; position != end; ++position) {
+                if (first_failure != nullptr
+                    && first_failure->load(std::memory_order_relaxed) < position)
+                {
+                    return;
+                }
+                try {
+                    auto result = std::invoke(transform, std::ranges::begin(range)[position]);
+                    if (!result.has_value()) {
+                        current.error.emplace(std::move(result).unwrap_err_unchecked());
+                        fail(position);
+                        return;
+                    }
+                    consume(current.state, position, std::move(result).unwrap_unchecked());
+                }
+                catch (...) {
+                    current.exception.emplace(Chunk_exception { std::current_exception() });
+                    fail(position);
+                    return;
+                }
+            }
+        };
+
+        if consteval {
+            if (chunk_count != 0) {
+                run_chunk(0, nullptr);
+            }
+        }
+        else {
+            std::atomic<std::size_t> first_failure { size };
+            auto job = [&](std::size_t const chunk) noexcept {
+                run_chunk(chunk, &first_failure);
+            };
+            parallel_run(
+                chunk_count,
+                thread_cap,
+                [](void* const context, std::size_t const chunk) noexcept {
+                    (*static_cast<decltype(job)*>(context))(chunk);
+                },
+                &job);
+        }
+
+        // The first chunk that failed holds the first failure.
+        for (Chunk& chunk : chunks) {
+            if (chunk.exception.has_value()) {
+                std::rethrow_exception(std::move(chunk.exception).unwrap_unchecked().pointer);
+            }
+            if (chunk.error.has_value()) {
+                return Error { std::move(chunk.error).unwrap_unchecked() };
+            }
+        }
+        return chunks;
+    }
+
+} // namespace aa::dtl
+
+namespace aa {
+
+    // Reduce the values that `transform` returns for the elements of `range` with `reduce`,
+    // starting from `init`, or return the first error. `reduce` must be associative: each chunk
+    // is reduced in parallel, and the chunks are then reduced in order. `transform` and `reduce`
+    // are called concurrently. After the first error, the remaining elements are skipped.
+    template <class R, class Acc, class Reduce, class Transform>
+        requires dtl::result_transform<Transform, R>
+              && std::is_constructible_v<Acc, dtl::Transform_value<Transform, R>>
+              && std::is_invocable_r_v<Acc, Reduce const&, Acc, Acc>
+    [[nodiscard]] constexpr auto try_transform_reduce(
+        R&&                    range,
+        Acc                    init,
+        Reduce const           reduce,
+        Transform const        transform,
+        Parallel_options const options = {}) -> Result<Acc, dtl::Transform_error<Transform, R>>
+    {
+        auto const accumulate = [&](Maybe<Acc>& partial, std::size_t, auto&& value) {
+            if (partial.has_value()) {
+                partial.emplace(std::invoke(
+                    reduce,
+                    std::move(partial).unwrap_unchecked(),
+                    Acc(std::forward<decltype(value)>(value))));
+            }
+            else {
+                partial.emplace(std::forward<decltype(value)>(value));
+            }
+        };
+
+        auto chunks = dtl::try_for_each_chunk<Maybe<Acc>>(range, transform, accumulate, options);
+        if (!chunks.has_value()) {
+            return Error { std::move(chunks).unwrap_err_unchecked() };
+        }
+        for (auto& chunk : chunks.unwrap_unchecked()) {
+            if (chunk.state.has_value()) {
+                init = std::invoke(
+                    reduce, std::move(init), std::move(chunk.state).unwrap_unchecked());
+            }
+        }
+        return init;
+    }
+
+    // Collect the values that `transform` returns for the elements of `range`, in order, or return
+    // the first error. `transform` is called concurrently. After the first error, the remaining
+    // elements are skipped. The vector is allocated once, at its final size. Values that are not
+    // trivially copyable are collected per chunk first, and then moved into it.
+    template <class R, class Transform>
+        requires dtl::result_transform<Transform, R>
+              && std::is_move_constructible_v<dtl::Transform_value<Transform, R>>
+    [[nodiscard]] constexpr auto try_collect(
+        R&& range, Transform const transform, Parallel_options const options = {})
+        -> Result<
+            std::vector<dtl::Transform_value<Transform, R>>,
+            dtl::Transform_error<Transform, R>>
+    {
+        using T = dtl::Transform_value<Transform, R>;
+
+        // Trivial values are written straight into place, after zeroing the vector.
+        if constexpr (std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>) {
+            std::vector<T> values(std::ranges::size(range));
+            auto const     store = [&](dtl::No_state&, std::size_t const position, T&& value) {
+                values[position] = value;
+            };
+            auto chunks = dtl::try_for_each_chunk<dtl::No_state>(range, transform, store, options);
+            if (!chunks.has_value()) {
+                return Error { std::move(chunks).unwrap_err_unchecked() };
+            }
+            return values;
+        }
+        else {
+            auto const append = [&](std::vector<T>& chunk, std::size_t, T&& value) {
+                chunk.push_back(std::move(value));
+            };
+            auto chunks
+                = dtl::try_for_each_chunk<std::vector<T>>(range, transform, append, options);
+            if (!chunks.has_value()) {
+                return Error { std::move(chunks).unwrap_err_unchecked() };
+            }
+            std::vector<T> values;
+            values.reserve(std::ranges::size(range));
+            for (auto& chunk : chunks.unwrap_unchecked()) {
+                std::ranges::move(chunk.state, std::back_inserter(values));
+            }
+            return values;
+        }
+    }
+
+} // namespace aa
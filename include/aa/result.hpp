@@ -4,69 +4,185 @@
 #include <aa/maybe.hpp>
 #include <aa/utility.hpp>
 
-namespace aa {
-
+namespace aa::dtl {
+    // Objects of stateless types carry no information, so any two of them are interchangeable.
     template <class T>
-    struct [[nodiscard]] Error final {
-        T value;
-    };
+    concept stateless = std::is_empty_v<T> && std::is_trivially_copyable_v<T>
+                     && std::is_trivially_default_constructible_v<T>;
+
+    template <class T, class Config>
+    concept has_sentinel = std::is_same_v<T, decltype(Config::sentinel_value())>;
+
+    // The value's sentinel encodes the error state, and the error itself takes up no space.
+    template <class T, class E, class Value_config, class Error_config>
+    concept value_niche = has_sentinel<T, Value_config> && stateless<E>;
+
+    // The error's sentinel encodes the value state, and the value itself takes up no space.
+    template <class T, class E, class Value_config, class Error_config>
+    concept error_niche = has_sentinel<E, Error_config> && stateless<T>
+                       && !value_niche<T, E, Value_config, Error_config>;
 
     template <
-        sane          T,
-        sane          E,
-        access_config Unwrap_config = Access_config_checked,
-        access_config Deref_config  = Access_config_checked>
-    class [[nodiscard]] Result final {
+        sane               T,
+        sane               E,
+        sentinel_config<T> Value_config,
+        sentinel_config<E> Error_config,
+        assignment_config  Assignment_config>
+    struct Result_core;
+
+    template <
+        sane               T,
+        sane               E,
+        sentinel_config<T> Value_config,
+        sentinel_config<E> Error_config,
+        assignment_config  Assignment_config>
+        requires(!value_niche<T, E, Value_config, Error_config>)
+             && (!error_niche<T, E, Value_config, Error_config>)
+    struct Result_core<T, E, Value_config, Error_config, Assignment_config> final {
         union {
             T m_value;
             E m_error;
         };
         bool m_has_value {};
 
-        static constexpr bool nothrow_unwrap = noexcept(Unwrap_config::validate_access(bool {}));
-        static constexpr bool nothrow_deref  = noexcept(Deref_config::validate_access(bool {}));
-    public:
-        constexpr Result() noexcept(std::is_nothrow_default_constructible_v<T>)
-            requires std::is_default_constructible_v<T>
-            : m_value()
-            , m_has_value(true)
-        {}
+        // Assignment may switch alternatives, which constructs one and destroys the other, so it is
+        // only trivial if those are trivial too. This keeps small results trivially copyable, which
+        // lets the x86-64 System V ABI pass and return them in registers.
+        static constexpr bool trivial_copy_assignment
+            = meta::All<std::is_trivially_copy_assignable, T, E>::value
+           && meta::All<std::is_trivially_copy_constructible, T, E>::value
+           && meta::All<std::is_trivially_destructible, T, E>::value;
 
-        template <class Arg = T>
-            requires(!tag_type<std::remove_cvref_t<Arg>>)
-                 && (!std::is_same_v<Result, std::remove_cvref_t<Arg>>)
-                 && std::is_constructible_v<T, Arg&&>
-        explicit(!std::is_convertible_v<Arg&&, T>) constexpr Result(Arg&& arg)
-            noexcept(noexcept(Result(in_place, std::forward<Arg>(arg))))
-            : Result(in_place, std::forward<Arg>(arg))
-        {}
+        static constexpr bool trivial_move_assignment
+            = meta::All<std::is_trivially_move_assignable, T, E>::value
+           && meta::All<std::is_trivially_move_constructible, T, E>::value
+           && meta::All<std::is_trivially_destructible, T, E>::value;
 
         template <class... Args>
-        explicit constexpr Result(In_place, Args&&... args)
+        explicit constexpr Result_core(In_place, Args&&... args)
             noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
-            requires std::is_constructible_v<T, Args&&...>
             : m_value(std::forward<Args>(args)...)
             , m_has_value(true)
         {}
 
-        template <class Err>
-        constexpr Result(Err&& err) noexcept // NOLINT: bugprone forwarding reference
-            requires std::is_same_v<Error<E>, std::remove_cvref_t<Err>>
-            : m_error(std::forward<Err>(err).value)
+        template <class... Args>
+        explicit constexpr Result_core(In_place_error, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<E, Args&&...>)
+            : m_error(std::forward<Args>(args)...)
+        {}
+
+        template <class Function, class... Args>
+        explicit constexpr Result_core(In_place_invoke, Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>)
+            : m_value(std::invoke(std::forward<Function>(function), std::forward<Args>(args)...))
+            , m_has_value(true)
+        {}
+
+        template <class Function, class... Args>
+        explicit constexpr Result_core(In_place_error_invoke, Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<E, Function&&, Args&&...>)
+            : m_error(std::invoke(std::forward<Function>(function), std::forward<Args>(args)...))
         {}
 
+        [[nodiscard]] constexpr auto has_value() const noexcept -> bool
+        {
+            return m_has_value;
+        }
+
         // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
 
-        Result(Result const&)
+        template <class... Args>
+        constexpr auto emplace_value(Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>) -> void
+        {
+            replace([&] noexcept(std::is_nothrow_constructible_v<T, Args&&...>) {
+                std::construct_at(this, in_place, std::forward<Args>(args)...);
+            });
+        }
+
+        template <class... Args>
+        constexpr auto emplace_error(Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<E, Args&&...>) -> void
+        {
+            replace([&] noexcept(std::is_nothrow_constructible_v<E, Args&&...>) {
+                std::construct_at(this, in_place_error, std::forward<Args>(args)...);
+            });
+        }
+
+        template <class Function, class... Args>
+        constexpr auto emplace_value_with(Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>) -> void
+        {
+            replace([&] noexcept(nothrow_invocable_into<T, Function&&, Args&&...>) {
+                std::construct_at(
+                    this,
+                    in_place_invoke,
+                    std::forward<Function>(function),
+                    std::forward<Args>(args)...);
+            });
+        }
+
+        // Destroy the core, and construct it again with `construct`. The whole core is
+        // reconstructed, because only a constructor's member initializer can elide the result of
+        // a function into a member. The basic guarantee falls back to the strong one if `T`
+        // cannot be value-initialized without throwing.
+        template <class Construct>
+        constexpr auto replace(Construct const& construct)
+            noexcept(std::is_nothrow_invocable_v<Construct const&>) -> void
+        {
+            if constexpr (std::is_nothrow_invocable_v<Construct const&>) {
+                std::destroy_at(this);
+                construct();
+            }
+            else if constexpr (
+                Assignment_config::strong_guarantee
+                || !std::is_nothrow_default_constructible_v<T>) {
+                if (m_has_value) {
+                    replace_or_restore(in_place, m_value, construct);
+                }
+                else {
+                    replace_or_restore(in_place_error, m_error, construct);
+                }
+            }
+            else {
+                std::destroy_at(this);
+                try {
+                    construct();
+                }
+                catch (...) {
+                    std::construct_at(this, in_place);
+                    throw;
+                }
+            }
+        }
+
+        // Strong guarantee: if `construct` throws, the active member `from` is restored.
+        template <class Tag, class From, class Construct>
+        constexpr auto replace_or_restore(Tag const tag, From& from, Construct const& construct)
+            -> void
+        {
+            From backup = std::move(from);
+            std::destroy_at(this);
+            try {
+                construct();
+            }
+            catch (...) {
+                std::construct_at(this, tag, std::move(backup));
+                throw;
+            }
+        }
+
+        Result_core(Result_core const&)
             requires(!meta::All<std::is_copy_constructible, T, E>::value)
         = delete;
-        Result(Result const&)
+        Result_core(Result_core const&)
             requires meta::All<std::is_trivially_copy_constructible, T, E>::value
         = default;
 
-        constexpr Result(Result const& other)
+        constexpr Result_core(Result_core const& other)
             noexcept(meta::All<std::is_nothrow_copy_constructible, T, E>::value)
             requires meta::All<std::is_copy_constructible, T, E>::value
+                  && (!meta::All<std::is_trivially_copy_constructible, T, E>::value)
             : m_has_value(other.m_has_value)
         {
             if (m_has_value) {
@@ -77,16 +193,17 @@ namespace aa {
             }
         }
 
-        Result(Result&&)
+        Result_core(Result_core&&)
             requires(!meta::All<std::is_move_constructible, T, E>::value)
         = delete;
-        Result(Result&&)
+        Result_core(Result_core&&)
             requires meta::All<std::is_trivially_move_constructible, T, E>::value
         = default;
 
-        constexpr Result(Result&& other)
+        constexpr Result_core(Result_core&& other)
             noexcept(meta::All<std::is_nothrow_move_constructible, T, E>::value)
             requires meta::All<std::is_move_constructible, T, E>::value
+                  && (!meta::All<std::is_trivially_move_constructible, T, E>::value)
             : m_has_value(other.m_has_value)
         {
             if (m_has_value) {
@@ -97,17 +214,17 @@ namespace aa {
             }
         }
 
-        auto operator=(Result const&) -> Result&
-            requires(!meta::All<std::is_copy_assignable, T, E>::value)
+        auto operator=(Result_core const&) -> Result_core&
+            requires(!meta::All<std::is_copy_constructible, T, E>::value)
         = delete;
-        auto operator=(Result const&) -> Result&
-            requires meta::All<std::is_trivially_copy_assignable, T, E>::value
+        auto operator=(Result_core const&) -> Result_core&
+            requires trivial_copy_assignment
         = default;
 
-        constexpr auto operator=(Result const& other)
-            noexcept(meta::All<Nothrow_copyable, T, E>::value) -> Result&
+        constexpr auto operator=(Result_core const& other)
+            noexcept(meta::All<Nothrow_copyable, T, E>::value) -> Result_core&
             requires meta::All<std::is_copy_constructible, T, E>::value
-                  && (!meta::All<std::is_trivially_copy_assignable, T, E>::value)
+                  && (!trivial_copy_assignment)
         {
             if (this != &other) {
                 if (m_has_value) {
@@ -115,14 +232,12 @@ namespace aa {
                         copy_assign(m_value, other.m_value);
                     }
                     else {
-                        reconstruct(*this, Error { other.m_error });
-                        m_has_value = false;
+                        emplace_error(other.m_error);
                     }
                 }
                 else {
                     if (other.m_has_value) {
-                        reconstruct(*this, other.m_value);
-                        m_has_value = true;
+                        emplace_value(other.m_value);
                     }
                     else {
                         copy_assign(m_error, other.m_error);
@@ -132,44 +247,43 @@ namespace aa {
             return *this;
         }
 
-        auto operator=(Result&&) -> Result&
-            requires(!std::is_move_assignable_v<T>)
+        auto operator=(Result_core&&) -> Result_core&
+            requires(!meta::All<std::is_move_constructible, T, E>::value)
         = delete;
-        auto operator=(Result&&) noexcept -> Result&
-            requires std::is_trivially_move_assignable_v<T>
+        auto operator=(Result_core&&) noexcept -> Result_core&
+            requires trivial_move_assignment
         = default;
 
-        constexpr auto operator=(Result&& other) noexcept -> Result&
-            requires std::is_move_constructible_v<T> && (!std::is_trivially_move_assignable_v<T>)
+        constexpr auto operator=(Result_core&& other) noexcept -> Result_core&
+            requires meta::All<std::is_move_constructible, T, E>::value
+                  && (!trivial_move_assignment)
         {
             if (this != &other) {
                 if (m_has_value) {
                     if (other.m_has_value) {
-                        move_assign(m_value, other.m_value);
+                        move_assign(m_value, std::move(other.m_value));
                     }
                     else {
-                        reconstruct(*this, Error { std::move(other.m_error) });
-                        m_has_value = false;
+                        emplace_error(std::move(other.m_error));
                     }
                 }
                 else {
                     if (other.m_has_value) {
-                        reconstruct(*this, std::move(other.m_value));
-                        m_has_value = true;
+                        emplace_value(std::move(other.m_value));
                     }
                     else {
-                        move_assign(m_error, other.m_error);
+                        move_assign(m_error, std::move(other.m_error));
                     }
                 }
             }
             return *this;
         }
 
-        ~Result()
+        ~Result_core()
             requires(meta::All<std::is_trivially_destructible, T, E>::value)
         = default;
 
-        constexpr ~Result()
+        constexpr ~Result_core()
             requires(!meta::All<std::is_trivially_destructible, T, E>::value)
         {
             if (m_has_value) {
@@ -180,101 +294,343 @@ namespace aa {
             }
         }
 
+        // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+    };
+
+    template <
+        sane               T,
+        sane               E,
+        sentinel_config<T> Value_config,
+        sentinel_config<E> Error_config,
+        assignment_config  Assignment_config>
+        requires value_niche<T, E, Value_config, Error_config>
+    struct Result_core<T, E, Value_config, Error_config, Assignment_config> final {
+        T m_value;
+        [[no_unique_address]] E m_error;
+
+        template <class... Args>
+        explicit constexpr Result_core(In_place, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
+            : m_value(std::forward<Args>(args)...)
+        {}
+
+        template <class... Args>
+        explicit constexpr Result_core(In_place_error, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<E, Args&&...>)
+            : m_value(Value_config::sentinel_value())
+            , m_error(std::forward<Args>(args)...)
+        {}
+
+        template <class Function, class... Args>
+        explicit constexpr Result_core(In_place_invoke, Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>)
+            : m_value(std::invoke(std::forward<Function>(function), std::forward<Args>(args)...))
+        {}
+
+        template <class Function, class... Args>
+        explicit constexpr Result_core(In_place_error_invoke, Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<E, Function&&, Args&&...>)
+            : m_value(Value_config::sentinel_value())
+            , m_error(std::invoke(std::forward<Function>(function), std::forward<Args>(args)...))
+        {}
+
+        [[nodiscard]] constexpr auto has_value() const
+            noexcept(noexcept(Value_config::is_sentinel_value(m_value))) -> bool
+        {
+            return !Value_config::is_sentinel_value(m_value);
+        }
+
+        template <class... Args>
+        constexpr auto emplace_value(Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>) -> void
+        {
+            move_assign(m_value, T(std::forward<Args>(args)...));
+        }
+
+        template <class... Args>
+        constexpr auto emplace_error(Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<E, Args&&...>) -> void
+        {
+            m_error = E(std::forward<Args>(args)...);
+            move_assign(m_value, Value_config::sentinel_value());
+        }
+
+        template <class Function, class... Args>
+        constexpr auto emplace_value_with(Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>) -> void
+        {
+            reconstruct(
+                *this, in_place_invoke, std::forward<Function>(function), std::forward<Args>(args)...);
+        }
+    };
+
+    template <
+        sane               T,
+        sane               E,
+        sentinel_config<T> Value_config,
+        sentinel_config<E> Error_config,
+        assignment_config  Assignment_config>
+        requires error_niche<T, E, Value_config, Error_config>
+    struct Result_core<T, E, Value_config, Error_config, Assignment_config> final {
+        [[no_unique_address]] T m_value;
+        E m_error;
+
+        template <class... Args>
+        explicit constexpr Result_core(In_place, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
+            : m_value(std::forward<Args>(args)...)
+            , m_error(Error_config::sentinel_value())
+        {}
+
+        template <class... Args>
+        explicit constexpr Result_core(In_place_error, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<E, Args&&...>)
+            : m_error(std::forward<Args>(args)...)
+        {}
+
+        template <class Function, class... Args>
+        explicit constexpr Result_core(In_place_invoke, Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>)
+            : m_value(std::invoke(std::forward<Function>(function), std::forward<Args>(args)...))
+            , m_error(Error_config::sentinel_value())
+        {}
+
+        template <class Function, class... Args>
+        explicit constexpr Result_core(In_place_error_invoke, Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<E, Function&&, Args&&...>)
+            : m_error(std::invoke(std::forward<Function>(function), std::forward<Args>(args)...))
+        {}
+
+        [[nodiscard]] constexpr auto has_value() const
+            noexcept(noexcept(Error_config::is_sentinel_value(m_error))) -> bool
+        {
+            return Error_config::is_sentinel_value(m_error);
+        }
+
+        template <class... Args>
+        constexpr auto emplace_value(Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>) -> void
+        {
+            m_value = T(std::forward<Args>(args)...);
+            move_assign(m_error, Error_config::sentinel_value());
+        }
+
+        template <class... Args>
+        constexpr auto emplace_error(Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<E, Args&&...>) -> void
+        {
+            move_assign(m_error, E(std::forward<Args>(args)...));
+        }
+
+        template <class Function, class... Args>
+        constexpr auto emplace_value_with(Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>) -> void
+        {
+            reconstruct(
+                *this, in_place_invoke, std::forward<Function>(function), std::forward<Args>(args)...);
+        }
+    };
+
+    // The sentinel config of an alternative `U` of a `Result` derived from one whose alternative
+    // was `T`, with `Config`. It is kept if the type is, and the default for `U` otherwise.
+    template <class U, class T, class Config>
+    using Derived_sentinel_config
+        = std::conditional_t<std::is_same_v<U, T>, Config, Sentinel_config_default_for<U>>;
+} // namespace aa::dtl
+
+namespace aa {
+
+    template <class T>
+    struct [[nodiscard]] Error final {
+        T value;
+    };
+
+    // `Origin` is the `Result` that the pipeline starts from, whose configs the result keeps.
+    template <class Node, class Origin>
+    class Lazy_result;
+
+    template <
+        sane               T,
+        sane               E,
+        access_config      Unwrap_config         = Access_config_checked,
+        access_config      Deref_config          = Access_config_checked,
+        sentinel_config<T> Value_sentinel_config = Sentinel_config_default_for<T>,
+        sentinel_config<E> Error_sentinel_config = Sentinel_config_default_for<E>,
+        assignment_config  Assignment_config     = Assignment_config_strong>
+    class [[nodiscard]] Result final {
+        dtl::Result_core<T, E, Value_sentinel_config, Error_sentinel_config, Assignment_config>
+            m_core;
+
+        static constexpr bool nothrow_unwrap = noexcept(Unwrap_config::validate_access(bool {}));
+        static constexpr bool nothrow_deref  = noexcept(Deref_config::validate_access(bool {}));
+
+        template <class, class>
+        friend class Lazy_result;
+
+        // A `Result` with the same configs, except for the sentinel configs of changed types.
+        template <class U, class F>
+        using Derived = Result<
+            U,
+            F,
+            Unwrap_config,
+            Deref_config,
+            dtl::Derived_sentinel_config<U, T, Value_sentinel_config>,
+            dtl::Derived_sentinel_config<F, E, Error_sentinel_config>,
+            Assignment_config>;
+    public:
+        constexpr Result() noexcept(std::is_nothrow_default_constructible_v<T>)
+            requires std::is_default_constructible_v<T>
+            : m_core(in_place)
+        {}
+
+        template <class Arg = T>
+            requires(!tag_type<std::remove_cvref_t<Arg>>)
+                 && (!std::is_same_v<Result, std::remove_cvref_t<Arg>>)
+                 && std::is_constructible_v<T, Arg&&>
+        explicit(!std::is_convertible_v<Arg&&, T>) constexpr Result(Arg&& arg)
+            noexcept(noexcept(Result(in_place, std::forward<Arg>(arg))))
+            : Result(in_place, std::forward<Arg>(arg))
+        {}
+
+        template <class... Args>
+        explicit constexpr Result(In_place, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
+            requires std::is_constructible_v<T, Args&&...>
+            : m_core(in_place, std::forward<Args>(args)...)
+        {}
+
+        template <class... Args>
+        explicit constexpr Result(In_place_error, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<E, Args&&...>)
+            requires std::is_constructible_v<E, Args&&...>
+            : m_core(in_place_error, std::forward<Args>(args)...)
+        {}
+
+        template <class Function, class... Args>
+        explicit constexpr Result(In_place_invoke, Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>)
+            requires std::is_invocable_r_v<T, Function&&, Args&&...>
+            : m_core(in_place_invoke, std::forward<Function>(function), std::forward<Args>(args)...)
+        {}
+
+        template <class Function, class... Args>
+        explicit constexpr Result(In_place_error_invoke, Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<E, Function&&, Args&&...>)
+            requires std::is_invocable_r_v<E, Function&&, Args&&...>
+            : m_core(
+                  in_place_error_invoke,
+                  std::forward<Function>(function),
+                  std::forward<Args>(args)...)
+        {}
+
+        template <class Err>
+        constexpr Result(Err&& err) noexcept // NOLINT: bugprone forwarding reference
+            requires std::is_same_v<Error<E>, std::remove_cvref_t<Err>>
+            : m_core(in_place_error, std::forward<Err>(err).value)
+        {}
+
         constexpr auto reset() noexcept -> void
             requires std::is_nothrow_default_constructible_v<T>
         {
-            if (m_has_value) {
-                move_assign(m_value, T {});
-            }
-            else {
-                std::destroy_at(std::addressof(m_error));
-                std::construct_at(std::addressof(m_value));
-                m_value = true;
-            }
+            m_core.emplace_value();
+        }
+
+        // Replace the content with the result of invoking `function` with `args`, which is elided
+        // into place. If `function` throws, `Assignment_config` decides what is left.
+        template <class Function, class... Args>
+            requires std::is_invocable_r_v<T, Function&&, Args&&...>
+        constexpr auto emplace_with(Function&& function, Args&&... args)
+            noexcept(nothrow_invocable_into<T, Function&&, Args&&...>) -> T&
+        {
+            m_core.emplace_value_with(
+                std::forward<Function>(function), std::forward<Args>(args)...);
+            return m_core.m_value;
         }
 
         [[nodiscard]] constexpr auto has_value() const noexcept -> bool
         {
-            return m_has_value;
+            return m_core.has_value();
         }
 
         [[nodiscard]] constexpr auto is_error() const noexcept -> bool
         {
-            return !m_has_value;
+            return !m_core.has_value();
         }
 
         [[nodiscard]] constexpr operator bool() const noexcept
         {
-            return m_has_value;
+            return m_core.has_value();
         }
 
         template <class Self>
         [[nodiscard]] constexpr auto operator*(this Self&& self)
             noexcept(nothrow_deref) -> Qualified_like<Self, T>
         {
-            Deref_config::validate_access(self.m_has_value);
-            return std::forward_like<Self>(self.m_value);
+            Deref_config::validate_access(self.has_value());
+            return std::forward_like<Self>(self.m_core.m_value);
         }
 
         [[nodiscard]] constexpr auto operator->(this auto&& self)
             noexcept(nothrow_deref) -> decltype(std::addressof(self.m_core.m_value))
         {
-            Deref_config::validate_access(self.m_has_value);
-            return std::addressof(self.m_value);
+            Deref_config::validate_access(self.has_value());
+            return std::addressof(self.m_core.m_value);
         }
 
         template <class Self>
-        [[nodiscard]] constexpr auto unwrap(this Self&& self)
+        [[nodiscard]] constexpr auto unwrap(
+            this Self&& self, std::source_location const caller = std::source_location::current())
             noexcept(nothrow_unwrap) -> Qualified_like<Self, T>
         {
-            Unwrap_config::validate_access(self.m_has_value);
-            return std::forward_like<Self>(self.m_value);
+            dtl::validate_access<Unwrap_config>(self.has_value(), caller);
+            return std::forward_like<Self>(self.m_core.m_value);
         }
 
         template <class Self>
         [[nodiscard]] constexpr auto unwrap_unchecked(this Self&& self) noexcept
             -> Qualified_like<Self, T>
         {
-            return std::forward_like<Self>(self.m_value);
+            return std::forward_like<Self>(self.m_core.m_value);
         }
 
         template <class Self>
-        [[nodiscard]] constexpr auto unwrap_err(this Self&& self)
+        [[nodiscard]] constexpr auto unwrap_err(
+            this Self&& self, std::source_location const caller = std::source_location::current())
             noexcept(nothrow_unwrap) -> Qualified_like<Self, E>
         {
-            Unwrap_config::validate_access(!self.m_has_value);
-            return std::forward_like<Self>(self.m_error);
+            dtl::validate_access<Unwrap_config>(!self.has_value(), caller);
+            return std::forward_like<Self>(self.m_core.m_error);
         }
 
         template <class Self>
         [[nodiscard]] constexpr auto unwrap_err_unchecked(this Self&& self) noexcept
             -> Qualified_like<Self, E>
         {
-            return std::forward_like<Self>(self.m_error);
+            return std::forward_like<Self>(self.m_core.m_error);
         }
 
         template <class Self>
         [[nodiscard]] constexpr auto val(this Self&& self)
             noexcept(std::is_nothrow_constructible_v<T, Qualified_like<Self, T>>)
-                -> Maybe<T, Unwrap_config, Deref_config>
+                -> Maybe<T, Unwrap_config, Deref_config, Value_sentinel_config>
         {
-            if (!self.m_has_value) {
+            if (!self.has_value()) {
                 return nothing;
             }
-            return Maybe<T, Unwrap_config, Deref_config>(
-                in_place, std::forward_like<Self>(self.m_value));
+            return Maybe<T, Unwrap_config, Deref_config, Value_sentinel_config>(
+                in_place, std::forward_like<Self>(self.m_core.m_value));
         }
 
         template <class Self>
         [[nodiscard]] constexpr auto err(this Self&& self)
             noexcept(std::is_nothrow_constructible_v<E, Qualified_like<Self, E>>)
-                -> Maybe<E, Unwrap_config, Deref_config>
+                -> Maybe<E, Unwrap_config, Deref_config, Error_sentinel_config>
         {
-            if (self.m_has_value) {
+            if (self.has_value()) {
                 return nothing;
             }
-            return Maybe<E, Unwrap_config, Deref_config>(
-                in_place, std::forward_like<Self>(self.m_error));
+            return Maybe<E, Unwrap_config, Deref_config, Error_sentinel_config>(
+                in_place, std::forward_like<Self>(self.m_core.m_error));
         }
 
         template <
@@ -283,14 +639,15 @@ namespace aa {
             class R = std::invoke_result_t<Function&&, Qualified_like<Self, T>>>
         [[nodiscard]] constexpr auto map(this Self&& self, Function&& function)
             noexcept(std::is_nothrow_invocable_v<Function&&, Qualified_like<Self, T>>)
-                -> Result<R, E, Unwrap_config, Deref_config>
+                -> Derived<R, E>
         {
-            if (self.m_has_value) {
-                return Result<R, E, Unwrap_config, Deref_config> { std::invoke(
-                    std::forward<Function>(function), std::forward_like<Self>(self.m_value)) };
+            if (self.has_value()) {
+                return Derived<R, E>(
+                    in_place_invoke,
+                    std::forward<Function>(function),
+                    std::forward_like<Self>(self.m_core.m_value));
             }
-            return Result<R, E, Unwrap_config, Deref_config> { Error<E> {
-                std::forward_like<Self>(self.m_error) } };
+            return Derived<R, E>(in_place_error, std::forward_like<Self>(self.m_core.m_error));
         }
 
         template <class Self, std::invocable<Qualified_like<Self, T>> Function>
@@ -298,9 +655,10 @@ namespace aa {
             noexcept(std::is_nothrow_invocable_v<Function&&, Qualified_like<Self, T>>) -> void
             requires std::is_void_v<std::invoke_result_t<Function&&, Qualified_like<Self, T>>>
         {
-            if (self.m_has_value) {
+            if (self.has_value()) {
                 std::invoke(
-                    std::forward<Function>(function), std::forward_like<Self>(self.m_value));
+                    std::forward<Function>(function),
+                    std::forward_like<Self>(self.m_core.m_value));
             }
         }
 
@@ -310,14 +668,15 @@ namespace aa {
             class R = std::invoke_result_t<Function&&, Qualified_like<Self, E>>>
         [[nodiscard]] constexpr auto map_err(this Self&& self, Function&& function)
             noexcept(std::is_nothrow_invocable_v<Function&&, Qualified_like<Self, E>>)
-                -> Result<T, R, Unwrap_config, Deref_config>
+                -> Derived<T, R>
         {
-            if (!self.m_has_value) {
-                return Result<T, R, Unwrap_config, Deref_config> { Error<R> { std::invoke(
-                    std::forward<Function>(function), std::forward_like<Self>(self.m_error)) } };
+            if (!self.has_value()) {
+                return Derived<T, R>(
+                    in_place_error_invoke,
+                    std::forward<Function>(function),
+                    std::forward_like<Self>(self.m_core.m_error));
             }
-            return Result<T, R, Unwrap_config, Deref_config> { std::forward_like<Self>(
-                self.m_value) };
+            return Derived<T, R>(in_place, std::forward_like<Self>(self.m_core.m_value));
         }
 
         template <class Self, std::invocable<Qualified_like<Self, E>> Function>
@@ -325,34 +684,140 @@ namespace aa {
             noexcept(std::is_nothrow_invocable_v<Function&&, Qualified_like<Self, E>>) -> void
             requires std::is_void_v<std::invoke_result_t<Function&&, Qualified_like<Self, E>>>
         {
-            if (!self.m_has_value) {
+            if (!self.has_value()) {
                 std::invoke(
-                    std::forward<Function>(function), std::forward_like<Self>(self.m_error));
+                    std::forward<Function>(function),
+                    std::forward_like<Self>(self.m_core.m_error));
             }
         }
 
-        [[nodiscard]] constexpr auto ref() & noexcept
-            -> Result<Ref<T>, Ref<E>, Unwrap_config, Deref_config>
+        [[nodiscard]] constexpr auto ref() & noexcept -> Derived<Ref<T>, Ref<E>>
         {
-            if (m_has_value) {
-                return Ref { m_value };
+            if (has_value()) {
+                return Ref { m_core.m_value };
             }
-            return Error { Ref { m_error } };
+            return Error { Ref { m_core.m_error } };
         }
 
-        [[nodiscard]] constexpr auto ref() const& noexcept
-            -> Result<Ref<T const>, Ref<E const>, Unwrap_config, Deref_config>
+        [[nodiscard]] constexpr auto ref() const& noexcept -> Derived<Ref<T const>, Ref<E const>>
         {
-            if (m_has_value) {
-                return Ref { m_value };
+            if (has_value()) {
+                return Ref { m_core.m_value };
             }
-            return Error { Ref { m_error } };
+            return Error { Ref { m_core.m_error } };
         }
 
         auto ref() &&      = delete;
         auto ref() const&& = delete;
 
-        // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+        // Start a lazy pipeline, which refers to this `Result` until it is evaluated. Nothing keeps
+        // the pipeline from outliving it: `auto pipeline = make().lazy();` dangles.
+        template <class Self>
+        [[nodiscard]] constexpr auto lazy(this Self&& self) noexcept
+            -> Lazy_result<dtl::Lazy_source<Self&&>, Result>
+        {
+            return Lazy_result<dtl::Lazy_source<Self&&>, Result>(
+                dtl::Lazy_source<Self&&> { std::forward<Self>(self) });
+        }
+    };
+
+    // The discriminant holds no pointers, so `Result` relocates like its alternatives.
+    template <class T, class E, class... Configs>
+    struct Trivially_relocatable<Result<T, E, Configs...>>
+        : std::conjunction<Trivially_relocatable<T>, Trivially_relocatable<E>> {};
+
+    // A chain of `map`, `map_err`, `and_then` and `or_else` steps, which is evaluated at once by
+    // `value_or` or `evaluate`. Unlike the same chain on `Result`, it constructs no intermediate
+    // `Result`. Every operation consumes the pipeline, so it has to be used as a single expression.
+    template <class Node, class Origin>
+    class [[nodiscard]] Lazy_result final {
+        Node m_node;
+
+        using Value     = std::remove_cvref_t<typename Node::Value>;
+        using Err       = std::remove_cvref_t<typename Node::Error>;
+        using Evaluated = typename Origin::template Derived<Value, Err>;
+
+        template <class Next_node>
+        using Next = Lazy_result<Next_node, Origin>;
+
+        template <class R>
+        using Value_of = std::remove_cvref_t<decltype(std::declval<R>().unwrap_unchecked())>;
+
+        template <class R>
+        using Error_of = std::remove_cvref_t<decltype(std::declval<R>().unwrap_err_unchecked())>;
+    public:
+        explicit constexpr Lazy_result(Node node)
+            noexcept(std::is_nothrow_move_constructible_v<Node>)
+            : m_node(std::move(node))
+        {}
+
+        template <std::invocable<typename Node::Value> Function>
+            requires(!std::is_void_v<std::invoke_result_t<Function, typename Node::Value>>)
+        [[nodiscard]] constexpr auto map(Function&& function) &&
+            -> Next<dtl::Lazy_map<Node, std::decay_t<Function>>>
+        {
+            return Next<dtl::Lazy_map<Node, std::decay_t<Function>>>(
+                { std::move(m_node), std::forward<Function>(function) });
+        }
+
+        template <std::invocable<typename Node::Error> Function>
+            requires(!std::is_void_v<std::invoke_result_t<Function, typename Node::Error>>)
+        [[nodiscard]] constexpr auto map_err(Function&& function) &&
+            -> Next<dtl::Lazy_map_err<Node, std::decay_t<Function>>>
+        {
+            return Next<dtl::Lazy_map_err<Node, std::decay_t<Function>>>(
+                { std::move(m_node), std::forward<Function>(function) });
+        }
+
+        // `function` returns a `Result` of the same error type.
+        template <std::invocable<typename Node::Value> Function>
+            requires dtl::lazy_result_like<std::invoke_result_t<Function, typename Node::Value>>
+                  && std::is_same_v<
+                         Err,
+                         Error_of<std::invoke_result_t<Function, typename Node::Value>>>
+        [[nodiscard]] constexpr auto and_then(Function&& function) &&
+            -> Next<dtl::Lazy_and_then<Node, std::decay_t<Function>>>
+        {
+            return Next<dtl::Lazy_and_then<Node, std::decay_t<Function>>>(
+                { std::move(m_node), std::forward<Function>(function) });
+        }
+
+        // `function` returns a `Result` of the same value type.
+        template <std::invocable<typename Node::Error> Function>
+            requires dtl::lazy_result_like<std::invoke_result_t<Function, typename Node::Error>>
+                  && std::is_same_v<
+                         Value,
+                         Value_of<std::invoke_result_t<Function, typename Node::Error>>>
+        [[nodiscard]] constexpr auto or_else(Function&& function) &&
+            -> Next<dtl::Lazy_or_else<Node, std::decay_t<Function>>>
+        {
+            return Next<dtl::Lazy_or_else<Node, std::decay_t<Function>>>(
+                { std::move(m_node), std::forward<Function>(function) });
+        }
+
+        template <class Fallback>
+            requires std::is_constructible_v<Value, Fallback&&>
+        [[nodiscard]] constexpr auto value_or(Fallback&& fallback) && -> Value
+        {
+            auto on_invoke = []<class Function, class V>(Function&& function, V&& value) -> Value {
+                return Value(std::invoke(std::forward<Function>(function), std::forward<V>(value)));
+            };
+            auto on_error = [&](auto&&) -> Value { return Value(std::forward<Fallback>(fallback)); };
+            return dtl::lazy_evaluate_invoke<Value>(m_node, on_invoke, on_error);
+        }
+
+        [[nodiscard]] constexpr auto evaluate() && -> Evaluated
+        {
+            auto on_invoke = []<class Function, class V>(Function&& function, V&& value)
+                -> Evaluated {
+                return Evaluated(
+                    in_place_invoke, std::forward<Function>(function), std::forward<V>(value));
+            };
+            auto on_error = [](auto&& error) -> Evaluated {
+                return Evaluated(in_place_error, std::forward<decltype(error)>(error));
+            };
+            return dtl::lazy_evaluate_invoke<Evaluated>(m_node, on_invoke, on_error);
+        }
     };
 
 } // namespace aa
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <aa/result.hpp>
+#include <aa/utility.hpp>
+#include <algorithm>
+#include <vector>
+#include <span>
+
+namespace aa {
+
+    // Column-oriented alternative to `std::vector<Result<T, E>>` for batches where errors are
+    // rare. Values are stored densely in row order, and errors are stored separately together
+    // with their row indices, so iterating over the values is a contiguous loop.
+    template <
+        sane          T,
+        sane          E,
+        access_config Unwrap_config = Access_config_checked,
+        access_config Deref_config  = Access_config_checked>
+    class Result_batch final {
+        std::vector<T>           m_values;
+        std::vector<E>           m_errors;
+        std::vector<std::size_t> m_error_rows; // Sorted, parallel to `m_errors`.
+
+        [[nodiscard]] constexpr auto errors_before(std::size_t const row) const noexcept
+            -> std::size_t
+        {
+            return static_cast<std::size_t>(
+                std::ranges::lower_bound(m_error_rows, row) - m_error_rows.begin());
+        }
+    public:
+        Result_batch() = default;
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return m_values.size() + m_errors.size();
+        }
+
+        [[nodiscard]] constexpr auto is_empty() const noexcept -> bool
+        {
+            return size() == 0;
+        }
+
+        [[nodiscard]] constexpr auto value_count() const noexcept -> std::size_t
+        {
+            return m_values.size();
+        }
+
+        [[nodiscard]] constexpr auto error_count() const noexcept -> std::size_t
+        {
+            return m_errors.size();
+        }
+
+        // Reserve space for `values` successful rows. Errors are expected to be rare, so no space
+        // is reserved for them.
+        constexpr auto reserve(std::size_t const values) -> void
+        {
+            m_values.reserve(values);
+        }
+
+        constexpr auto clear() noexcept -> void
+        {
+            m_values.clear();
+            m_errors.clear();
+            m_error_rows.clear();
+        }
+
+        // Append a successful row.
+        template <class... Args>
+        constexpr auto push_value(Args&&... args) -> T&
+            requires std::is_constructible_v<T, Args&&...>
+        {
+            return m_values.emplace_back(std::forward<Args>(args)...);
+        }
+
+        // Append a failed row.
+        template <class... Args>
+        constexpr auto push_error(Args&&... args) -> E&
+            requires std::is_constructible_v<E, Args&&...>
+        {
+            m_error_rows.push_back(size());
+            try {
+                return m_errors.emplace_back(std::forward<Args>(args)...);
+            }
+            catch (...) {
+                m_error_rows.pop_back();
+                throw;
+            }
+        }
+
+        // Precondition: `row < size()`
+        [[nodiscard]] constexpr auto is_error(std::size_t const row) const noexcept -> bool
+        {
+            std::size_t const index = errors_before(row);
+            return index != m_error_rows.size() && m_error_rows[index] == row;
+        }
+
+        // Precondition: `row < size()`
+        [[nodiscard]] constexpr auto operator[](std::size_t const row) noexcept
+            -> Result<Ref<T>, Ref<E>, Unwrap_config, Deref_config>
+        {
+            std::size_t const index = errors_before(row);
+            if (index != m_error_rows.size() && m_error_rows[index] == row) {
+                return Error { Ref { m_errors[index] } };
+            }
+            return Ref { m_values[row - index] };
+        }
+
+        // Precondition: `row < size()`
+        [[nodiscard]] constexpr auto operator[](std::size_t const row) const noexcept
+            -> Result<Ref<T const>, Ref<E const>, Unwrap_config, Deref_config>
+        {
+            std::size_t const index = errors_before(row);
+            if (index != m_error_rows.size() && m_error_rows[index] == row) {
+                return Error { Ref { m_errors[index] } };
+            }
+            return Ref { m_values[row - index] };
+        }
+
+        // The values of all successful rows, in row order.
+        [[nodiscard]] constexpr auto values() noexcept -> std::span<T>
+        {
+            return m_values;
+        }
+
+        [[nodiscard]] constexpr auto values() const noexcept -> std::span<T const>
+        {
+            return m_values;
+        }
+
+        // The errors of all failed rows, in row order. See also `error_rows`.
+        [[nodiscard]] constexpr auto errors() noexcept -> std::span<E>
+        {
+            return m_errors;
+        }
+
+        [[nodiscard]] constexpr auto errors() const noexcept -> std::span<E const>
+        {
+            return m_errors;
+        }
+
+        // The row index of each error in `errors()`, in ascending order.
+        [[nodiscard]] constexpr auto error_rows() const noexcept -> std::span<std::size_t const>
+        {
+            return m_error_rows;
+        }
+    };
+
+} // namespace aa
+
+namespace aa::inline basics {
+    using aa::Result_batch;
+}
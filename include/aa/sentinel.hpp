@@ -0,0 +1,104 @@
+#pragma once
+
+#include <aa/utility.hpp>
+#include <string_view>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <bit>
+
+// Opt-in sentinel configs for common types. These are not the defaults because the sentinel is a
+// value that the type can otherwise legitimately hold, such as a null pointer or a maximum index.
+// Pass one explicitly as the sentinel config of `Maybe` to make it exactly as large as `T`.
+
+namespace aa::detail {
+    template <class T>
+    concept nullable = std::is_pointer_v<T> || specialization_of<T, std::unique_ptr>;
+
+    template <class T>
+    concept nullable_data = requires(T const& value) {
+        requires std::is_trivially_copyable_v<T>;
+        requires std::is_nothrow_default_constructible_v<T>;
+        requires std::is_pointer_v<decltype(value.data())>;
+    };
+
+    template <std::floating_point T>
+    struct Float_bits;
+    template <>
+    struct Float_bits<float> : std::type_identity<std::uint32_t> {
+        static constexpr std::uint32_t quiet_nan_payload = 0x7FC0'0AA5;
+    };
+    template <>
+    struct Float_bits<double> : std::type_identity<std::uint64_t> {
+        static constexpr std::uint64_t quiet_nan_payload = 0x7FF8'0000'0000'0AA5;
+    };
+} // namespace aa::detail
+
+namespace aa {
+
+    // The sentinel is the null pointer.
+    template <class T>
+        requires detail::nullable<T>
+    struct Sentinel_null final {
+        Sentinel_null() = delete;
+        static constexpr bool is_bitwise = std::is_pointer_v<T>;
+        static constexpr auto sentinel_value() noexcept -> T
+        {
+            return T {};
+        }
+        static constexpr auto is_sentinel_value(T const& value) noexcept -> bool
+        {
+            return value == nullptr;
+        }
+    };
+
+    // The sentinel is a default-constructed view, whose data pointer is null.
+    // Note that an empty view that was constructed from a non-null pointer is not the sentinel.
+    template <class T>
+        requires detail::nullable_data<T>
+    struct Sentinel_null_data final {
+        Sentinel_null_data() = delete;
+        static constexpr auto sentinel_value() noexcept -> T
+        {
+            return T {};
+        }
+        static constexpr auto is_sentinel_value(T const& value) noexcept -> bool
+        {
+            return value.data() == nullptr;
+        }
+    };
+
+    // The sentinel is a quiet NaN with a specific payload, so NaNs produced by ordinary
+    // arithmetic are not mistaken for the sentinel.
+    template <std::floating_point T>
+        requires requires { typename detail::Float_bits<T>::type; }
+    struct Sentinel_nan final {
+        Sentinel_nan() = delete;
+        static constexpr bool is_bitwise = true;
+        static constexpr auto sentinel_value() noexcept -> T
+        {
+            return std::bit_cast<T>(detail::Float_bits<T>::quiet_nan_payload);
+        }
+        static constexpr auto is_sentinel_value(T const value) noexcept -> bool
+        {
+            return std::bit_cast<typename detail::Float_bits<T>::type>(value)
+                == detail::Float_bits<T>::quiet_nan_payload;
+        }
+    };
+
+    // The sentinel is the integer `sentinel`, which defaults to the maximum value of `T`.
+    template <std::integral T, T sentinel = std::numeric_limits<T>::max()>
+    struct Sentinel_int final {
+        Sentinel_int() = delete;
+        static constexpr bool is_bitwise = true;
+        static constexpr auto sentinel_value() noexcept -> T
+        {
+            return sentinel;
+        }
+        static constexpr auto is_sentinel_value(T const value) noexcept -> bool
+        {
+            return value == sentinel;
+        }
+    };
+
+} // namespace aa
@@ -0,0 +1,478 @@
+#include <aa/simd.hpp>
+#include <algorithm>
+#include <cstring>
+#include <array>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define AA_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define AA_SIMD_X86 0
+#endif
+
+namespace {
+
+    using aa::simd::dtl::Key_layout;
+
+    constexpr std::size_t word_bits = 64;
+
+    auto load_key(std::byte const* const key, std::size_t const key_size) noexcept -> std::uint64_t
+    {
+        switch (key_size) {
+        case 1:
+        {
+            std::uint8_t value {};
+            std::memcpy(&value, key, sizeof value);
+            return value;
+        }
+        case 2:
+        {
+            std::uint16_t value {};
+            std::memcpy(&value, key, sizeof value);
+            return value;
+        }
+        case 4:
+        {
+            std::uint32_t value {};
+            std::memcpy(&value, key, sizeof value);
+            return value;
+        }
+        default:
+        {
+            std::uint64_t value {};
+            std::memcpy(&value, key, sizeof value);
+            return value;
+        }
+        }
+    }
+
+    auto store_key(std::byte* const key, std::size_t const key_size, std::uint64_t const value)
+        noexcept -> void
+    {
+        switch (key_size) {
+        case 1:
+        {
+            auto const narrow = static_cast<std::uint8_t>(value);
+            std::memcpy(key, &narrow, sizeof narrow);
+            return;
+        }
+        case 2:
+        {
+            auto const narrow = static_cast<std::uint16_t>(value);
+            std::memcpy(key, &narrow, sizeof narrow);
+            return;
+        }
+        case 4:
+        {
+            auto const narrow = static_cast<std::uint32_t>(value);
+            std::memcpy(key, &narrow, sizeof narrow);
+            return;
+        }
+        default:
+            std::memcpy(key, &value, sizeof value);
+            return;
+        }
+    }
+
+    // Presence bits of keys `[first, last)`, relative to `first`. Requires `last - first <= 64`.
+    auto scalar_mask_word(Key_layout const layout, std::size_t const first, std::size_t const last)
+        noexcept -> std::uint64_t
+    {
+        std::uint64_t word = 0;
+        for (std::size_t index = first; index != last; ++index) {
+            bool const present
+                = load_key(layout.keys + index * layout.stride, layout.key_size) != layout.absent;
+            word |= static_cast<std::uint64_t>(present) << (index - first);
+        }
+        return word;
+    }
+
+    // Keep every other bit of `bits`, halving its width. Used to turn byte masks of
+    // 16-bit comparisons into one bit per element.
+    constexpr auto compress_even_bits(std::uint32_t bits) noexcept -> std::uint32_t
+    {
+        bits &= 0x5555'5555U;
+        bits = (bits | (bits >> 1U)) & 0x3333'3333U;
+        bits = (bits | (bits >> 2U)) & 0x0F0F'0F0FU;
+        bits = (bits | (bits >> 4U)) & 0x00FF'00FFU;
+        bits = (bits | (bits >> 8U)) & 0x0000'FFFFU;
+        return bits;
+    }
+
+    template <auto mask_word>
+    auto mask_with(Key_layout const layout, std::uint64_t* const mask) noexcept -> void
+    {
+        for (std::size_t first = 0; first < layout.count; first += word_bits) {
+            mask[first / word_bits]
+                = mask_word(layout, first, std::min(first + word_bits, layout.count));
+        }
+    }
+
+    template <auto mask_word>
+    auto count_with(Key_layout const layout) noexcept -> std::size_t
+    {
+        std::size_t present = 0;
+        for (std::size_t first = 0; first < layout.count; first += word_bits) {
+            present += static_cast<std::size_t>(std::popcount(
+                mask_word(layout, first, std::min(first + word_bits, layout.count))));
+        }
+        return present;
+    }
+
+    template <auto mask_word>
+    auto compact_with(Key_layout const layout, std::byte* const output) noexcept -> std::size_t
+    {
+        std::size_t written = 0;
+        for (std::size_t first = 0; first < layout.count; first += word_bits) {
+            std::uint64_t bits
+                = mask_word(layout, first, std::min(first + word_bits, layout.count));
+            for (; bits != 0; bits &= bits - 1) {
+                std::size_t const index = first + static_cast<std::size_t>(std::countr_zero(bits));
+                std::memcpy(
+                    output + written * layout.key_size,
+                    layout.keys + index * layout.stride,
+                    layout.key_size);
+                ++written;
+            }
+        }
+        return written;
+    }
+
+    auto scalar_replace_absent(
+        std::byte* const    keys,
+        std::size_t const   key_size,
+        std::size_t const   count,
+        std::uint64_t const absent,
+        std::uint64_t const replacement) noexcept -> void
+    {
+        for (std::size_t index = 0; index != count; ++index) {
+            if (load_key(keys + index * key_size, key_size) == absent) {
+                store_key(keys + index * key_size, key_size, replacement);
+            }
+        }
+    }
+
+#if AA_SIMD_X86
+
+    // SSE4.2
+
+    [[gnu::target("sse4.2")]] auto sse_equal(
+        __m128i const values, __m128i const absent, std::size_t const key_size) noexcept -> __m128i
+    {
+        switch (key_size) {
+        case 1:  return _mm_cmpeq_epi8(values, absent);
+        case 2:  return _mm_cmpeq_epi16(values, absent);
+        case 4:  return _mm_cmpeq_epi32(values, absent);
+        default: return _mm_cmpeq_epi64(values, absent);
+        }
+    }
+
+    [[gnu::target("sse4.2")]] auto sse_broadcast(
+        std::uint64_t const value, std::size_t const key_size) noexcept -> __m128i
+    {
+        switch (key_size) {
+        case 1:  return _mm_set1_epi8(static_cast<char>(value));
+        case 2:  return _mm_set1_epi16(static_cast<short>(value));
+        case 4:  return _mm_set1_epi32(static_cast<int>(value));
+        default: return _mm_set1_epi64x(static_cast<long long>(value));
+        }
+    }
+
+    // One bit per element of a 16-byte comparison result.
+    [[gnu::target("sse4.2")]] auto sse_element_bits(
+        __m128i const equal, std::size_t const key_size) noexcept -> std::uint32_t
+    {
+        switch (key_size) {
+        case 1:  return static_cast<std::uint32_t>(_mm_movemask_epi8(equal));
+        case 2:  return compress_even_bits(static_cast<std::uint32_t>(_mm_movemask_epi8(equal)));
+        case 4:  return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+        default: return static_cast<std::uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(equal)));
+        }
+    }
+
+    [[gnu::target("sse4.2")]] auto sse_mask_word(
+        Key_layout const layout, std::size_t const first, std::size_t const last) noexcept
+        -> std::uint64_t
+    {
+        if (layout.stride != layout.key_size) {
+            return scalar_mask_word(layout, first, last);
+        }
+        std::size_t const lanes  = 16 / layout.key_size;
+        __m128i const     absent = sse_broadcast(layout.absent, layout.key_size);
+        std::uint64_t     word   = 0;
+        std::size_t       index  = first;
+        for (; index + lanes <= last; index += lanes) {
+            __m128i const values = _mm_loadu_si128(
+                reinterpret_cast<__m128i const*>(layout.keys + index * layout.key_size));
+            std::uint32_t const absent_bits
+                = sse_element_bits(sse_equal(values, absent, layout.key_size), layout.key_size);
+            std::uint64_t const present_bits = ~absent_bits & ((1U << lanes) - 1);
+            word |= present_bits << (index - first);
+        }
+        if (index != last) {
+            word |= scalar_mask_word(layout, index, last) << (index - first);
+        }
+        return word;
+    }
+
+    [[gnu::target("sse4.2")]] auto sse_replace_absent(
+        std::byte* const    keys,
+        std::size_t const   key_size,
+        std::size_t const   count,
+        std::uint64_t const absent,
+        std::uint64_t const replacement) noexcept -> void
+    {
+        std::size_t const lanes         = 16 / key_size;
+        __m128i const     absent_v      = sse_broadcast(absent, key_size);
+        __m128i const     replacement_v = sse_broadcast(replacement, key_size);
+        std::size_t       index         = 0;
+        for (; index + lanes <= count; index += lanes) {
+            auto* const   address = reinterpret_cast<__m128i*>(keys + index * key_size);
+            __m128i const values  = _mm_loadu_si128(address);
+            __m128i const equal   = sse_equal(values, absent_v, key_size);
+            _mm_storeu_si128(address, _mm_blendv_epi8(values, replacement_v, equal));
+        }
+        scalar_replace_absent(
+            keys + index * key_size, key_size, count - index, absent, replacement);
+    }
+
+    // AVX2
+
+    [[gnu::target("avx2")]] auto avx_equal(
+        __m256i const values, __m256i const absent, std::size_t const key_size) noexcept -> __m256i
+    {
+        switch (key_size) {
+        case 1:  return _mm256_cmpeq_epi8(values, absent);
+        case 2:  return _mm256_cmpeq_epi16(values, absent);
+        case 4:  return _mm256_cmpeq_epi32(values, absent);
+        default: return _mm256_cmpeq_epi64(values, absent);
+        }
+    }
+
+    [[gnu::target("avx2")]] auto avx_broadcast(
+        std::uint64_t const value, std::size_t const key_size) noexcept -> __m256i
+    {
+        switch (key_size) {
+        case 1:  return _mm256_set1_epi8(static_cast<char>(value));
+        case 2:  return _mm256_set1_epi16(static_cast<short>(value));
+        case 4:  return _mm256_set1_epi32(static_cast<int>(value));
+        default: return _mm256_set1_epi64x(static_cast<long long>(value));
+        }
+    }
+
+    // One bit per element of a 32-byte comparison result.
+    [[gnu::target("avx2")]] auto avx_element_bits(
+        __m256i const equal, std::size_t const key_size) noexcept -> std::uint32_t
+    {
+        switch (key_size) {
+        case 1:  return static_cast<std::uint32_t>(_mm256_movemask_epi8(equal));
+        case 2:  return compress_even_bits(static_cast<std::uint32_t>(_mm256_movemask_epi8(equal)));
+        case 4:  return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+        default: return static_cast<std::uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(equal)));
+        }
+    }
+
+    // Gathers single-byte keys at an arbitrary stride, which is the layout of flag-based `Maybe`.
+    [[gnu::target("avx2")]] auto avx_gather_mask_word(
+        Key_layout const layout, std::size_t const first, std::size_t const last) noexcept
+        -> std::uint64_t
+    {
+        // Each gather reads four bytes starting at a key, so stop early enough that those bytes
+        // belong to later elements instead of running past the end of the range.
+        std::size_t const tail   = (3 + layout.stride - 1) / layout.stride;
+        auto const        stride = static_cast<int>(layout.stride);
+        __m256i const     offsets = _mm256_mullo_epi32(
+            _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride));
+        __m256i const low_byte = _mm256_set1_epi32(0xFF);
+        __m256i const absent   = _mm256_set1_epi32(static_cast<int>(layout.absent));
+        std::uint64_t word     = 0;
+        std::size_t   index    = first;
+        for (; index + 8 + tail <= layout.count && index + 8 <= last; index += 8) {
+            __m256i const keys = _mm256_and_si256(
+                _mm256_i32gather_epi32(
+                    reinterpret_cast<int const*>(layout.keys + index * layout.stride), offsets, 1),
+                low_byte);
+            auto const absent_bits = static_cast<std::uint32_t>(
+                _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(keys, absent))));
+            word |= static_cast<std::uint64_t>(~absent_bits & 0xFFU) << (index - first);
+        }
+        if (index != last) {
+            word |= scalar_mask_word(layout, index, last) << (index - first);
+        }
+        return word;
+    }
+
+    [[gnu::target("avx2")]] auto avx_mask_word(
+        Key_layout const layout, std::size_t const first, std::size_t const last) noexcept
+        -> std::uint64_t
+    {
+        if (layout.stride != layout.key_size) {
+            if (layout.key_size == 1 && layout.stride * 8 <= 0x7FFF'FFFF) {
+                return avx_gather_mask_word(layout, first, last);
+            }
+            return scalar_mask_word(layout, first, last);
+        }
+        std::size_t const lanes  = 32 / layout.key_size;
+        __m256i const     absent = avx_broadcast(layout.absent, layout.key_size);
+        std::uint64_t     word   = 0;
+        std::size_t       index  = first;
+        for (; index + lanes <= last; index += lanes) {
+            __m256i const values = _mm256_loadu_si256(
+                reinterpret_cast<__m256i const*>(layout.keys + index * layout.key_size));
+            std::uint64_t const absent_bits
+                = avx_element_bits(avx_equal(values, absent, layout.key_size), layout.key_size);
+            std::uint64_t const present_bits
+                = ~absent_bits & ((std::uint64_t { 1 } << lanes) - 1);
+            word |= present_bits << (index - first);
+        }
+        if (index != last) {
+            word |= scalar_mask_word(layout, index, last) << (index - first);
+        }
+        return word;
+    }
+
+    // For each 8-bit mask of present 32-bit lanes, the permutation that packs them to the front.
+    constexpr auto compaction_table = [] {
+        std::array<std::array<std::int32_t, 8>, 256> table {};
+        for (std::size_t mask = 0; mask != table.size(); ++mask) {
+            std::size_t written = 0;
+            for (std::size_t lane = 0; lane != 8; ++lane) {
+                if ((mask >> lane) & 1U) {
+                    table[mask][written++] = static_cast<std::int32_t>(lane);
+                }
+            }
+        }
+        return table;
+    }();
+
+    // Packs present 4- and 8-byte keys of a dense layout with a lane permutation per vector.
+    [[gnu::target("avx2")]] auto avx_compact(Key_layout const layout, std::byte* const output)
+        noexcept -> std::size_t
+    {
+        if (layout.stride != layout.key_size || (layout.key_size != 4 && layout.key_size != 8)) {
+            return compact_with<avx_mask_word>(layout, output);
+        }
+        std::size_t const count = layout.count;
+        std::size_t const lanes  = 32 / layout.key_size;
+        __m256i const     absent = avx_broadcast(layout.absent, layout.key_size);
+        __m256i const     ramp   = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        std::size_t       written = 0;
+        std::size_t       index   = 0;
+        for (; index + lanes <= count; index += lanes) {
+            __m256i const values = _mm256_loadu_si256(
+                reinterpret_cast<__m256i const*>(layout.keys + index * layout.key_size));
+            std::uint32_t present = ~avx_element_bits(avx_equal(values, absent, layout.key_size),
+                                                      layout.key_size)
+                                  & ((1U << lanes) - 1);
+            std::size_t const present_count = static_cast<std::size_t>(std::popcount(present));
+            if (layout.key_size == 8) {
+                // Each 64-bit lane is a pair of 32-bit lanes.
+                std::uint32_t pairs = 0;
+                for (std::size_t lane = 0; lane != 4; ++lane) {
+                    pairs |= ((present >> lane) & 1U) * (3U << (lane * 2));
+                }
+                present = pairs;
+            }
+            __m256i const permutation = _mm256_loadu_si256(
+                reinterpret_cast<__m256i const*>(compaction_table[present].data()));
+            auto const store_lanes = static_cast<int>(
+                present_count * layout.key_size / sizeof(std::int32_t));
+            __m256i const store_mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(store_lanes), ramp);
+            _mm256_maskstore_epi32(
+                reinterpret_cast<int*>(output + written * layout.key_size),
+                store_mask,
+                _mm256_permutevar8x32_epi32(values, permutation));
+            written += present_count;
+        }
+        Key_layout const rest {
+            .keys     = layout.keys + index * layout.key_size,
+            .stride   = layout.stride,
+            .key_size = layout.key_size,
+            .count    = count - index,
+            .absent   = layout.absent,
+        };
+        return written + compact_with<scalar_mask_word>(rest, output + written * layout.key_size);
+    }
+
+    [[gnu::target("avx2")]] auto avx_replace_absent(
+        std::byte* const    keys,
+        std::size_t const   key_size,
+        std::size_t const   count,
+        std::uint64_t const absent,
+        std::uint64_t const replacement) noexcept -> void
+    {
+        std::size_t const lanes         = 32 / key_size;
+        __m256i const     absent_v      = avx_broadcast(absent, key_size);
+        __m256i const     replacement_v = avx_broadcast(replacement, key_size);
+        std::size_t       index         = 0;
+        for (; index + lanes <= count; index += lanes) {
+            auto* const   address = reinterpret_cast<__m256i*>(keys + index * key_size);
+            __m256i const values  = _mm256_loadu_si256(address);
+            __m256i const equal   = avx_equal(values, absent_v, key_size);
+            _mm256_storeu_si256(address, _mm256_blendv_epi8(values, replacement_v, equal));
+        }
+        scalar_replace_absent(
+            keys + index * key_size, key_size, count - index, absent, replacement);
+    }
+
+#endif // AA_SIMD_X86
+
+} // namespace
+
+auto aa::simd::dtl::kernels_for(Isa isa) noexcept -> Kernels const&
+{
+    isa = std::min(isa, supported_isa());
+
+    static constexpr Kernels scalar {
+        .presence_mask  = mask_with<scalar_mask_word>,
+        .count_present  = count_with<scalar_mask_word>,
+        .compact_keys   = compact_with<scalar_mask_word>,
+        .replace_absent = scalar_replace_absent,
+    };
+#if AA_SIMD_X86
+    static constexpr Kernels sse42 {
+        .presence_mask  = mask_with<sse_mask_word>,
+        .count_present  = count_with<sse_mask_word>,
+        .compact_keys   = compact_with<sse_mask_word>,
+        .replace_absent = sse_replace_absent,
+    };
+    static constexpr Kernels avx2 {
+        .presence_mask  = mask_with<avx_mask_word>,
+        .count_present  = count_with<avx_mask_word>,
+        .compact_keys   = avx_compact,
+        .replace_absent = avx_replace_absent,
+    };
+    switch (isa) {
+    case Isa::avx2:  return avx2;
+    case Isa::sse42: return sse42;
+    case Isa::scalar: return scalar;
+    }
+#else
+    static_cast<void>(isa);
+#endif
+    return scalar;
+}
+
+auto aa::simd::dtl::supported_isa() noexcept -> Isa
+{
+#if AA_SIMD_X86
+    static Isa const isa = [] {
+        if (__builtin_cpu_supports("avx2")) {
+            return Isa::avx2;
+        }
+        if (__builtin_cpu_supports("sse4.2")) {
+            return Isa::sse42;
+        }
+        return Isa::scalar;
+    }();
+    return isa;
+#else
+    return Isa::scalar;
+#endif
+}
+
+auto aa::simd::dtl::active_kernels() noexcept -> Kernels const&
+{
+    static Kernels const& kernels = kernels_for(supported_isa());
+    return kernels;
+}
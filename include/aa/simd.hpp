@@ -0,0 +1,248 @@
+#pragma once
+
+#include <aa/maybe.hpp>
+#include <aa/utility.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <bit>
+
+namespace aa::simd::dtl {
+
+    // Element `i` is present if the `key_size` bytes at `keys + i * stride` differ from `absent`.
+    struct Key_layout {
+        std::byte const* keys = nullptr;
+        std::size_t      stride {};
+        std::size_t      key_size {};
+        std::size_t      count {};
+        std::uint64_t    absent {};
+    };
+
+    enum class Isa : std::uint8_t { scalar, sse42, avx2 };
+
+    struct Kernels {
+        auto (*presence_mask)(Key_layout, std::uint64_t* mask) noexcept -> void;
+        auto (*count_present)(Key_layout) noexcept -> std::size_t;
+        auto (*compact_keys)(Key_layout, std::byte* output) noexcept -> std::size_t;
+        auto (*replace_absent)(
+            std::byte*    keys,
+            std::size_t   key_size,
+            std::size_t   count,
+            std::uint64_t absent,
+            std::uint64_t replacement) noexcept -> void;
+    };
+
+    // The best instruction set supported by the executing CPU.
+    auto supported_isa() noexcept -> Isa;
+
+    // Kernels for `isa`, or for `supported_isa()` if `isa` is not supported.
+    auto kernels_for(Isa isa) noexcept -> Kernels const&;
+
+    // Kernels for `supported_isa()`, selected once on first use.
+    auto active_kernels() noexcept -> Kernels const&;
+
+    template <class T>
+    [[nodiscard]] auto key_bits(T const& value) noexcept -> std::uint64_t
+    {
+        if constexpr (sizeof(T) == 1) {
+            return std::bit_cast<std::uint8_t>(value);
+        }
+        else if constexpr (sizeof(T) == 2) {
+            return std::bit_cast<std::uint16_t>(value);
+        }
+        else if constexpr (sizeof(T) == 4) {
+            return std::bit_cast<std::uint32_t>(value);
+        }
+        else {
+            return std::bit_cast<std::uint64_t>(value);
+        }
+    }
+
+    template <class>
+    struct Layout_traits {
+        static constexpr bool batchable = false;
+    };
+
+    template <class T, class Unwrap_config, class Deref_config, class Sentinel_config>
+    struct Layout_traits<Maybe<T, Unwrap_config, Deref_config, Sentinel_config>> {
+        using Value = T;
+
+        // The presence flag of the flag-based `Maybe_core` is a single byte.
+        static constexpr bool flagged = std::is_void_v<decltype(Sentinel_config::sentinel_value())>;
+
+        // Sentinel-based: the value itself is the key, compared bitwise against the sentinel.
+        static constexpr bool bitwise = bitwise_sentinel_config<Sentinel_config, T>
+                                     && std::has_single_bit(sizeof(T)) && sizeof(T) <= 8;
+
+        static constexpr bool batchable = flagged || bitwise;
+
+        template <class Element, std::size_t extent>
+        [[nodiscard]] static auto layout(std::span<Element, extent> const maybes) noexcept
+            -> Key_layout
+        {
+            auto& core = aa::dtl::Maybe_access::core(maybes.front());
+            if constexpr (flagged) {
+                return Key_layout {
+                    .keys = reinterpret_cast<std::byte const*>(std::addressof(core.m_has_value)),
+                    .stride   = sizeof(Element),
+                    .key_size = sizeof(bool),
+                    .count    = maybes.size(),
+                    .absent   = 0,
+                };
+            }
+            else {
+                return Key_layout {
+                    .keys     = reinterpret_cast<std::byte const*>(std::addressof(core.m_value)),
+                    .stride   = sizeof(Element),
+                    .key_size = sizeof(T),
+                    .count    = maybes.size(),
+                    .absent   = key_bits(Sentinel_config::sentinel_value()),
+                };
+            }
+        }
+    };
+
+    template <class R>
+    using Element = std::remove_reference_t<std::ranges::range_reference_t<R>>;
+
+    template <class R>
+    using Traits = Layout_traits<std::remove_cv_t<Element<R>>>;
+
+} // namespace aa::simd::dtl
+
+namespace aa::simd {
+
+    // Maybe types whose presence can be tested with a single integer comparison per element:
+    // either the flag-based layout, or a bitwise sentinel of size 1, 2, 4 or 8.
+    template <class M>
+    concept batchable = dtl::Layout_traits<M>::batchable;
+
+    template <class R>
+    concept maybe_range = std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+                       && batchable<std::remove_cv_t<dtl::Element<R>>>;
+
+    // Set bit `i % 64` of `mask[i / 64]` if and only if `maybes[i]` has a value.
+    // Precondition: `mask.size() >= (std::ranges::size(maybes) + 63) / 64`
+    template <maybe_range R>
+    constexpr auto presence_mask(R&& maybes, std::span<std::uint64_t> const mask) -> void
+    {
+        std::span const span { maybes };
+        if consteval {
+            std::ranges::fill(mask.first((span.size() + 63) / 64), std::uint64_t {});
+            for (std::size_t index = 0; index != span.size(); ++index) {
+                mask[index / 64] |= std::uint64_t { span[index].has_value() } << (index % 64);
+            }
+        }
+        else {
+            if (!span.empty()) {
+                dtl::active_kernels().presence_mask(dtl::Traits<R>::layout(span), mask.data());
+            }
+        }
+    }
+
+    // Number of elements of `maybes` that have a value.
+    template <maybe_range R>
+    [[nodiscard]] constexpr auto count_present(R&& maybes) -> std::size_t
+    {
+        std::span const span { maybes };
+        if consteval {
+            return static_cast<std::size_t>(std::ranges::count_if(
+                span, [](auto const& maybe) { return maybe.has_value(); }));
+        }
+        else {
+            if (span.empty()) {
+                return 0;
+            }
+            return dtl::active_kernels().count_present(dtl::Traits<R>::layout(span));
+        }
+    }
+
+    // Copy the present values of `maybes` to the front of `output`, preserving their order,
+    // and return how many were copied. Precondition: `output.size() >= count_present(maybes)`
+    template <maybe_range R>
+        requires std::is_copy_assignable_v<typename dtl::Traits<R>::Value>
+    constexpr auto compact_values(
+        R&& maybes, std::span<typename dtl::Traits<R>::Value> const output) -> std::size_t
+    {
+        std::span const span { maybes };
+        std::size_t     written = 0;
+        if consteval {
+            for (auto const& maybe : span) {
+                if (maybe.has_value()) {
+                    output[written++] = maybe.unwrap_unchecked();
+                }
+            }
+        }
+        else {
+            if (span.empty()) {
+                return 0;
+            }
+            if constexpr (dtl::Traits<R>::bitwise) {
+                written = dtl::active_kernels().compact_keys(
+                    dtl::Traits<R>::layout(span), reinterpret_cast<std::byte*>(output.data()));
+            }
+            else {
+                for (std::size_t first = 0; first < span.size(); first += 64) {
+                    std::size_t const count = std::min<std::size_t>(64, span.size() - first);
+                    std::uint64_t     bits {};
+                    dtl::active_kernels().presence_mask(
+                        dtl::Traits<R>::layout(span.subspan(first, count)), &bits);
+                    for (; bits != 0; bits &= bits - 1) {
+                        output[written++]
+                            = span[first + static_cast<std::size_t>(std::countr_zero(bits))]
+                                  .unwrap_unchecked();
+                    }
+                }
+            }
+        }
+        return written;
+    }
+
+    // Give every element of `maybes` that has no value the value `fallback`.
+    template <maybe_range R>
+        requires(!std::is_const_v<dtl::Element<R>>)
+             && std::is_copy_constructible_v<typename dtl::Traits<R>::Value>
+    constexpr auto fill_missing(R&& maybes, typename dtl::Traits<R>::Value const& fallback) -> void
+    {
+        std::span const span { maybes };
+        if consteval {
+            for (auto& maybe : span) {
+                if (!maybe.has_value()) {
+                    maybe.emplace(fallback);
+                }
+            }
+        }
+        else {
+            if (span.empty()) {
+                return;
+            }
+            if constexpr (dtl::Traits<R>::bitwise) {
+                dtl::Key_layout const layout = dtl::Traits<R>::layout(span);
+                dtl::active_kernels().replace_absent(
+                    const_cast<std::byte*>(layout.keys), // NOLINT: the elements are not const
+                    layout.key_size,
+                    layout.count,
+                    layout.absent,
+                    dtl::key_bits(fallback));
+            }
+            else {
+                for (std::size_t first = 0; first < span.size(); first += 64) {
+                    std::size_t const count = std::min<std::size_t>(64, span.size() - first);
+                    std::uint64_t     bits {};
+                    dtl::active_kernels().presence_mask(
+                        dtl::Traits<R>::layout(span.subspan(first, count)), &bits);
+                    std::uint64_t const all
+                        = count == 64 ? ~std::uint64_t {} : (std::uint64_t { 1 } << count) - 1;
+                    for (bits = ~bits & all; bits != 0; bits &= bits - 1) {
+                        std::size_t const index
+                            = first + static_cast<std::size_t>(std::countr_zero(bits));
+                        span[index].emplace(fallback);
+                    }
+                }
+            }
+        }
+    }
+
+} // namespace aa::simd
@@ -0,0 +1,468 @@
+#pragma once
+
+#include <aa/meta.hpp>
+#include <aa/maybe.hpp>
+#include <aa/utility.hpp>
+#include <source_location>
+#include <functional>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace aa::dtl {
+
+    // One alternative per nesting level. Each constructor activates at most one alternative,
+    // which the owner destroys, so the destructor does nothing.
+    template <class...>
+    union Sum_union {};
+
+    template <class T, class... Ts>
+    union Sum_union<T, Ts...> {
+        T                m_first;
+        Sum_union<Ts...> m_rest;
+
+        static constexpr bool trivially_destructible
+            = meta::All<std::is_trivially_destructible, T, Ts...>::value;
+
+        // No active alternative.
+        constexpr Sum_union() noexcept {}
+
+        template <class... Args>
+        explicit constexpr Sum_union(In_place_index<0>, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
+            : m_first(std::forward<Args>(args)...)
+        {}
+
+        template <std::size_t index, class... Args>
+            requires(index != 0)
+        explicit constexpr Sum_union(In_place_index<index>, Args&&... args) noexcept(
+            std::is_nothrow_constructible_v<Sum_union<Ts...>, In_place_index<index - 1>, Args&&...>)
+            : m_rest(in_place_index<index - 1>, std::forward<Args>(args)...)
+        {}
+
+        Sum_union(Sum_union const&)                    = default;
+        Sum_union(Sum_union&&)                         = default;
+        auto operator=(Sum_union const&) -> Sum_union& = default;
+        auto operator=(Sum_union&&) -> Sum_union&      = default;
+
+        ~Sum_union()
+            requires trivially_destructible
+        = default;
+
+        constexpr ~Sum_union()
+            requires(!trivially_destructible)
+        {}
+    };
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
+
+    template <std::size_t index, class Union>
+    [[nodiscard]] constexpr auto sum_get(Union& sum_union) noexcept -> auto&
+    {
+        if constexpr (index == 0) {
+            return sum_union.m_first;
+        }
+        else {
+            return sum_get<index - 1>(sum_union.m_rest);
+        }
+    }
+
+    // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+
+    template <std::size_t index>
+    using Index_constant = std::integral_constant<std::size_t, index>;
+
+    inline constexpr std::size_t dispatch_width = 64;
+
+#define AA_DISPATCH_CASE(offset)                                                            \
+    case base + (offset):                                                                   \
+        if constexpr (base + (offset) < count) {                                            \
+            return std::forward<Function>(function)(Index_constant<base + (offset)> {});   \
+        }                                                                                   \
+        else {                                                                              \
+            std::unreachable();                                                             \
+        }
+
+#define AA_DISPATCH_CASES_4(offset)                                                         \
+    AA_DISPATCH_CASE((offset) + 0)                                                          \
+    AA_DISPATCH_CASE((offset) + 1)                                                          \
+    AA_DISPATCH_CASE((offset) + 2)                                                          \
+    AA_DISPATCH_CASE((offset) + 3)
+
+#define AA_DISPATCH_CASES_16(offset)                                                        \
+    AA_DISPATCH_CASES_4((offset) + 0)                                                       \
+    AA_DISPATCH_CASES_4((offset) + 4)                                                       \
+    AA_DISPATCH_CASES_4((offset) + 8)                                                       \
+    AA_DISPATCH_CASES_4((offset) + 12)
+
+    // Invoke `function` with `Index_constant<index>`. Each level is a switch over sixty-four
+    // dense cases, which compilers lower to a single jump table, and its default case continues
+    // with the next sixty-four indices. Unlike a table of function pointers, every case can be
+    // inlined. Cases past `count` are unreachable, so they add no code.
+    // Precondition: `index < count`
+    template <std::size_t count, std::size_t base = 0, class Function>
+    constexpr auto dispatch_index(std::size_t const index, Function&& function) -> decltype(auto)
+    {
+        switch (index) {
+            AA_DISPATCH_CASES_16(0)
+            AA_DISPATCH_CASES_16(16)
+            AA_DISPATCH_CASES_16(32)
+            AA_DISPATCH_CASES_16(48)
+        default:
+            if constexpr (base + dispatch_width < count) {
+                return dispatch_index<count, base + dispatch_width>(
+                    index, std::forward<Function>(function));
+            }
+            else {
+                std::unreachable();
+            }
+        }
+    }
+
+#undef AA_DISPATCH_CASES_16
+#undef AA_DISPATCH_CASES_4
+#undef AA_DISPATCH_CASE
+
+    // Checked with constant expression loops over arrays, since compilers limit a fold to 256
+    // operands, and a `Sum` may have more alternatives.
+    template <bool... values>
+    inline constexpr bool all_true
+        = std::ranges::all_of(std::array { values..., true }, std::identity {});
+
+    template <class... Ts>
+    inline constexpr bool distinct
+        = std::ranges::all_of(meta::dtl::first_occurrences<Ts...>(), std::identity {});
+
+    // The visitor accepts every alternative, with the same result type.
+    template <class Visitor, class... Ts>
+    concept sum_visitor
+        = all_true<std::invocable<Visitor, Ts>...>
+       && all_true<std::is_same_v<
+              std::invoke_result_t<Visitor, Ts>,
+              std::invoke_result_t<Visitor, typename meta::At<0, meta::List<Ts...>>::type>>...>;
+
+} // namespace aa::dtl
+
+namespace aa {
+
+    // Holds one of `Ts`, which are distinct types. The index of the active alternative is stored
+    // in the smallest unsigned type that can represent it, and `visit` dispatches through a flat
+    // switch. Trivially copyable if every alternative is.
+    template <sane... Ts>
+        requires(sizeof...(Ts) != 0) && dtl::distinct<Ts...>
+    class Sum final {
+        dtl::Sum_union<Ts...>                     m_union;
+        dtl::Smallest_unsigned<sizeof...(Ts) - 1> m_index {};
+
+        template <std::size_t index>
+        using Alternative = typename meta::At<index, meta::List<Ts...>>::type;
+
+        template <class T>
+        static constexpr std::size_t index_of = meta::Index_of<T, meta::List<Ts...>>::value;
+
+        // Assignment may switch alternatives, which constructs one and destroys another, so it is
+        // only trivial if those are trivial too.
+        static constexpr bool trivial_copy_assignment
+            = meta::All<std::is_trivially_copy_assignable, Ts...>::value
+           && meta::All<std::is_trivially_copy_constructible, Ts...>::value
+           && meta::All<std::is_trivially_destructible, Ts...>::value;
+
+        static constexpr bool trivial_move_assignment
+            = meta::All<std::is_trivially_move_assignable, Ts...>::value
+           && meta::All<std::is_trivially_move_constructible, Ts...>::value
+           && meta::All<std::is_trivially_destructible, Ts...>::value;
+
+        template <class Function>
+        constexpr auto dispatch(Function&& function) const -> decltype(auto)
+        {
+            return dtl::dispatch_index<sizeof...(Ts)>(m_index, std::forward<Function>(function));
+        }
+
+        // Construct the alternative of `other` in `m_union`, which has no active alternative.
+        template <class Other>
+        constexpr auto construct_from(Other&& other) -> void
+        {
+            other.dispatch([&]<std::size_t index>(dtl::Index_constant<index>) {
+                std::construct_at(
+                    std::addressof(m_union),
+                    in_place_index<index>,
+                    std::forward_like<Other>(dtl::sum_get<index>(other.m_union)));
+            });
+        }
+
+        template <class Other>
+        constexpr auto assign(Other&& other) -> void
+        {
+            other.dispatch([&]<std::size_t index>(dtl::Index_constant<index>) {
+                auto& alternative = dtl::sum_get<index>(other.m_union);
+                if (m_index != index) {
+                    emplace<index>(std::forward_like<Other>(alternative));
+                }
+                else if constexpr (std::is_rvalue_reference_v<Other&&>) {
+                    move_assign(dtl::sum_get<index>(m_union), std::move(alternative));
+                }
+                else {
+                    copy_assign(dtl::sum_get<index>(m_union), alternative);
+                }
+            });
+        }
+
+        constexpr auto destroy() noexcept -> void
+        {
+            if constexpr (!meta::All<std::is_trivially_destructible, Ts...>::value) {
+                dispatch([&]<std::size_t index>(dtl::Index_constant<index>) {
+                    std::destroy_at(std::addressof(dtl::sum_get<index>(m_union)));
+                });
+            }
+        }
+    public:
+        // Value-initialize the first alternative.
+        constexpr Sum() noexcept(std::is_nothrow_default_constructible_v<Alternative<0>>)
+            requires std::is_default_constructible_v<Alternative<0>>
+            : m_union(in_place_index<0>)
+        {}
+
+        template <std::size_t index, class... Args>
+            requires(index < sizeof...(Ts))
+                 && std::is_constructible_v<Alternative<index>, Args&&...>
+        explicit constexpr Sum(In_place_index<index>, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<Alternative<index>, Args&&...>)
+            : m_union(in_place_index<index>, std::forward<Args>(args)...)
+            , m_index(index)
+        {}
+
+        template <class T, class... Args>
+            requires one_of<T, Ts...> && std::is_constructible_v<T, Args&&...>
+        explicit constexpr Sum(In_place_type<T>, Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
+            : Sum(in_place_index<index_of<T>>, std::forward<Args>(args)...)
+        {}
+
+        // Only an exact alternative converts implicitly, so the choice is never ambiguous.
+        template <class Arg>
+            requires one_of<std::remove_cvref_t<Arg>, Ts...>
+        constexpr Sum(Arg&& arg)
+            noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<Arg>, Arg&&>)
+            : Sum(in_place_index<index_of<std::remove_cvref_t<Arg>>>, std::forward<Arg>(arg))
+        {}
+
+        Sum(Sum const&)
+            requires(!meta::All<std::is_copy_constructible, Ts...>::value)
+        = delete;
+        Sum(Sum const&)
+            requires meta::All<std::is_trivially_copy_constructible, Ts...>::value
+        = default;
+
+        constexpr Sum(Sum const& other)
+            noexcept(meta::All<std::is_nothrow_copy_constructible, Ts...>::value)
+            requires meta::All<std::is_copy_constructible, Ts...>::value
+                  && (!meta::All<std::is_trivially_copy_constructible, Ts...>::value)
+            : m_index(other.m_index)
+        {
+            construct_from(other);
+        }
+
+        Sum(Sum&&)
+            requires(!meta::All<std::is_move_constructible, Ts...>::value)
+        = delete;
+        Sum(Sum&&)
+            requires meta::All<std::is_trivially_move_constructible, Ts...>::value
+        = default;
+
+        constexpr Sum(Sum&& other) noexcept
+            requires meta::All<std::is_move_constructible, Ts...>::value
+                  && (!meta::All<std::is_trivially_move_constructible, Ts...>::value)
+            : m_index(other.m_index)
+        {
+            construct_from(std::move(other));
+        }
+
+        auto operator=(Sum const&) -> Sum&
+            requires(!meta::All<std::is_copy_constructible, Ts...>::value)
+        = delete;
+        auto operator=(Sum const&) -> Sum&
+            requires trivial_copy_assignment
+        = default;
+
+        constexpr auto operator=(Sum const& other)
+            noexcept(meta::All<Nothrow_copyable, Ts...>::value) -> Sum&
+            requires meta::All<std::is_copy_constructible, Ts...>::value
+                  && (!trivial_copy_assignment)
+        {
+            if (this != &other) {
+                assign(other);
+            }
+            return *this;
+        }
+
+        auto operator=(Sum&&) -> Sum&
+            requires(!meta::All<std::is_move_constructible, Ts...>::value)
+        = delete;
+        auto operator=(Sum&&) noexcept -> Sum&
+            requires trivial_move_assignment
+        = default;
+
+        constexpr auto operator=(Sum&& other) noexcept -> Sum&
+            requires meta::All<std::is_move_constructible, Ts...>::value
+                  && (!trivial_move_assignment)
+        {
+            if (this != &other) {
+                assign(std::move(other));
+            }
+            return *this;
+        }
+
+        ~Sum()
+            requires(meta::All<std::is_trivially_destructible, Ts...>::value)
+        = default;
+
+        constexpr ~Sum()
+            requires(!meta::All<std::is_trivially_destructible, Ts...>::value)
+        {
+            destroy();
+        }
+
+        [[nodiscard]] constexpr auto index() const noexcept -> std::size_t
+        {
+            return m_index;
+        }
+
+        template <class T>
+            requires one_of<T, Ts...>
+        [[nodiscard]] constexpr auto holds() const noexcept -> bool
+        {
+            return m_index == index_of<T>;
+        }
+
+        // Replace the active alternative. If constructing the new one may throw, it is constructed
+        // before the old one is destroyed, so that the old one remains on failure.
+        template <std::size_t index, class... Args>
+            requires(index < sizeof...(Ts))
+                 && std::is_constructible_v<Alternative<index>, Args&&...>
+                 && (std::is_nothrow_constructible_v<Alternative<index>, Args && ...>
+                     || std::is_move_constructible_v<Alternative<index>>)
+        constexpr auto emplace(Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<Alternative<index>, Args&&...>)
+            -> Alternative<index>&
+        {
+            if constexpr (std::is_nothrow_constructible_v<Alternative<index>, Args&&...>) {
+                destroy();
+                std::construct_at(
+                    std::addressof(m_union), in_place_index<index>, std::forward<Args>(args)...);
+            }
+            else {
+                Alternative<index> alternative(std::forward<Args>(args)...);
+                destroy();
+                std::construct_at(
+                    std::addressof(m_union), in_place_index<index>, std::move(alternative));
+            }
+            m_index = index;
+            return dtl::sum_get<index>(m_union);
+        }
+
+        template <class T, class... Args>
+            requires one_of<T, Ts...>
+        constexpr auto emplace(Args&&... args)
+            noexcept(std::is_nothrow_constructible_v<T, Args&&...>) -> T&
+        {
+            return emplace<index_of<T>>(std::forward<Args>(args)...);
+        }
+
+        template <std::size_t index, class Self>
+            requires(index < sizeof...(Ts))
+        [[nodiscard]] constexpr auto unwrap(
+            this Self&& self, std::source_location const caller = std::source_location::current())
+            -> Qualified_like<Self, Alternative<index>>
+        {
+            dtl::validate_access<Access_config_checked>(self.m_index == index, caller);
+            return std::forward_like<Self>(dtl::sum_get<index>(self.m_union));
+        }
+
+        template <class T, class Self>
+            requires one_of<T, Ts...>
+        [[nodiscard]] constexpr auto unwrap(
+            this Self&& self, std::source_location const caller = std::source_location::current())
+            -> Qualified_like<Self, T>
+        {
+            return std::forward<Self>(self).template unwrap<index_of<T>>(caller);
+        }
+
+        // Precondition: `index() == index`
+        template <std::size_t index, class Self>
+            requires(index < sizeof...(Ts))
+        [[nodiscard]] constexpr auto unwrap_unchecked(this Self&& self) noexcept
+            -> Qualified_like<Self, Alternative<index>>
+        {
+            return std::forward_like<Self>(dtl::sum_get<index>(self.m_union));
+        }
+
+        // A reference to the alternative at `index`, if it is active.
+        template <std::size_t index>
+            requires(index < sizeof...(Ts))
+        [[nodiscard]] constexpr auto try_get() & noexcept -> Maybe<Ref<Alternative<index>>>
+        {
+            if (m_index == index) {
+                return Ref { dtl::sum_get<index>(m_union) };
+            }
+            return nothing;
+        }
+
+        template <std::size_t index>
+            requires(index < sizeof...(Ts))
+        [[nodiscard]] constexpr auto try_get() const& noexcept
+            -> Maybe<Ref<Alternative<index> const>>
+        {
+            if (m_index == index) {
+                return Ref { dtl::sum_get<index>(m_union) };
+            }
+            return nothing;
+        }
+
+        template <class T>
+            requires one_of<T, Ts...>
+        [[nodiscard]] constexpr auto try_get() & noexcept -> Maybe<Ref<T>>
+        {
+            return try_get<index_of<T>>();
+        }
+
+        template <class T>
+            requires one_of<T, Ts...>
+        [[nodiscard]] constexpr auto try_get() const& noexcept -> Maybe<Ref<T const>>
+        {
+            return try_get<index_of<T>>();
+        }
+
+        template <std::size_t>
+        auto try_get() && = delete;
+        template <std::size_t>
+        auto try_get() const&& = delete;
+        template <class>
+        auto try_get() && = delete;
+        template <class>
+        auto try_get() const&& = delete;
+
+        // Invoke `visitor` with the active alternative.
+        template <class Self, class Visitor>
+            requires dtl::sum_visitor<Visitor&&, Qualified_like<Self, Ts>...>
+        constexpr auto visit(this Self&& self, Visitor&& visitor) -> decltype(auto)
+        {
+            auto const visit_alternative
+                = [&]<std::size_t index>(dtl::Index_constant<index>) -> decltype(auto) {
+                      return std::invoke(
+                          std::forward<Visitor>(visitor),
+                          std::forward_like<Self>(dtl::sum_get<index>(self.m_union)));
+                  };
+            return self.dispatch(visit_alternative);
+        }
+    };
+
+    // The index holds no pointers, so `Sum` relocates like its alternatives.
+    template <class... Ts>
+    struct Trivially_relocatable<Sum<Ts...>> : std::conjunction<Trivially_relocatable<Ts>...> {};
+
+} // namespace aa
+
+namespace aa::inline basics {
+    using aa::Sum;
+}
@@ -1 +1,6 @@
 #include <aa/utility.hpp>
+
+auto aa::dtl::throw_bad_access(std::source_location const caller) -> void
+{
+    throw Bad_access { caller };
+}
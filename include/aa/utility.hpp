@@ -3,6 +3,11 @@
 #include <source_location>
 #include <type_traits>
 #include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <limits>
 #include <utility>
 #include <memory>
 
@@ -18,6 +23,50 @@ namespace aa::detail {
     struct Is_specialization_of<F, F<Args...>> : std::true_type {};
 } // namespace aa::detail
 
+namespace aa::dtl {
+
+    // Out of line and cold, so that a checked access inlines to a comparison and a jump that is
+    // predicted not taken, without exception handling code in the caller.
+    [[noreturn, gnu::cold, gnu::noinline]] auto throw_bad_access(std::source_location caller)
+        -> void;
+
+    // Access configs may take the location of the access as a second argument.
+    template <class Config>
+    constexpr auto validate_access(bool const has_value, std::source_location const caller)
+        noexcept(noexcept(Config::validate_access(has_value))) -> void
+    {
+        if constexpr (requires { Config::validate_access(has_value, caller); }) {
+            Config::validate_access(has_value, caller);
+        }
+        else {
+            Config::validate_access(has_value);
+        }
+    }
+
+    // The smallest unsigned integer type that can represent `max`.
+    template <std::size_t max>
+    using Smallest_unsigned = std::conditional_t<
+        max <= std::numeric_limits<std::uint8_t>::max(),
+        std::uint8_t,
+        std::conditional_t<
+            max <= std::numeric_limits<std::uint16_t>::max(),
+            std::uint16_t,
+            std::conditional_t<
+                max <= std::numeric_limits<std::uint32_t>::max(),
+                std::uint32_t,
+                std::size_t>>>;
+
+    [[noreturn]] inline auto trap() noexcept -> void
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_trap();
+#else
+        std::abort();
+#endif
+    }
+
+} // namespace aa::dtl
+
 namespace aa {
 
     struct In_place final : detail::Internal_tag_type_base {
@@ -25,6 +74,25 @@ namespace aa {
     };
     inline constexpr In_place in_place { detail::Internal_construct_tag {} };
 
+    struct In_place_error final : detail::Internal_tag_type_base {
+        explicit consteval In_place_error(detail::Internal_construct_tag) {}
+    };
+    inline constexpr In_place_error in_place_error { detail::Internal_construct_tag {} };
+
+    // Construct the value from the result of invoking a function with the remaining arguments.
+    // A prvalue result is elided directly into place, so the value is never moved.
+    struct In_place_invoke final : detail::Internal_tag_type_base {
+        explicit consteval In_place_invoke(detail::Internal_construct_tag) {}
+    };
+    inline constexpr In_place_invoke in_place_invoke { detail::Internal_construct_tag {} };
+
+    struct In_place_error_invoke final : detail::Internal_tag_type_base {
+        explicit consteval In_place_error_invoke(detail::Internal_construct_tag) {}
+    };
+    inline constexpr In_place_error_invoke in_place_error_invoke {
+        detail::Internal_construct_tag {}
+    };
+
     template <class>
     struct In_place_type final : detail::Internal_tag_type_base {
         explicit consteval In_place_type(detail::Internal_construct_tag) {}
@@ -32,6 +100,13 @@ namespace aa {
     template <class T>
     constexpr In_place_type<T> in_place_type { detail::Internal_construct_tag {} };
 
+    template <std::size_t>
+    struct In_place_index final : detail::Internal_tag_type_base {
+        explicit consteval In_place_index(detail::Internal_construct_tag) {}
+    };
+    template <std::size_t index>
+    constexpr In_place_index<index> in_place_index { detail::Internal_construct_tag {} };
+
     template <class T>
     concept tag_type = std::is_base_of_v<detail::Internal_tag_type_base, T>;
 
@@ -63,6 +138,15 @@ namespace aa {
     template <class T>
     concept nothrow_movable = Nothrow_movable<T>::value;
 
+    // Invoking `F` with `Args` initializes a `T` without throwing. Unlike
+    // `std::is_nothrow_invocable_r_v`, a prvalue `T` result is not required to be movable.
+    template <class T, class F, class... Args>
+    concept nothrow_invocable_into = requires {
+        requires std::is_nothrow_invocable_v<F, Args...>;
+        requires std::is_same_v<std::invoke_result_t<F, Args...>, T>
+                     || std::is_nothrow_convertible_v<std::invoke_result_t<F, Args...>, T>;
+    };
+
     template <class T, class... Ts>
     concept one_of = std::disjunction_v<std::is_same<T, Ts>...>;
 
@@ -163,6 +247,76 @@ namespace aa {
         }
     }
 
+    // Relocating an object moves it to a new address and ends its lifetime at the old one. For
+    // trivially relocatable types, that is equivalent to copying its bytes and forgetting the old
+    // ones, without calling the move constructor or the destructor. Trivially copyable types are
+    // trivially relocatable, and other types may opt in by specializing `Trivially_relocatable`
+    // if they hold no pointers into themselves.
+    template <class T>
+    struct Trivially_relocatable : std::is_trivially_copyable<T> {};
+    template <class T>
+    concept trivially_relocatable = sane<T> && Trivially_relocatable<T>::value;
+
+    // Relocate `*from` to the uninitialized storage at `to`.
+    template <sane T>
+        requires std::is_move_constructible_v<T>
+    constexpr auto relocate(T* const from, T* const to) noexcept -> void
+    {
+        if constexpr (trivially_relocatable<T>) {
+            if !consteval {
+                std::memcpy(static_cast<void*>(to), static_cast<void const*>(from), sizeof(T));
+                return;
+            }
+        }
+        std::construct_at(to, std::move(*from));
+        std::destroy_at(from);
+    }
+
+    // Relocate the `count` objects starting at `from` to the uninitialized storage starting at
+    // `to`, and return the end of the relocated objects. The ranges may only overlap if `to`
+    // comes first, as when closing the gap left by an erased element.
+    template <sane T>
+        requires std::is_move_constructible_v<T>
+    constexpr auto relocate_n(T* const from, std::size_t const count, T* const to) noexcept -> T*
+    {
+        if constexpr (trivially_relocatable<T>) {
+            if !consteval {
+                if (count != 0) {
+                    std::memmove(
+                        static_cast<void*>(to), static_cast<void const*>(from), count * sizeof(T));
+                }
+                return to + count;
+            }
+        }
+        for (std::size_t index = 0; index != count; ++index) {
+            relocate(from + index, to + index);
+        }
+        return to + count;
+    }
+
+    // Allocate storage for `new_capacity` objects from `allocator`, relocate the `size` objects at
+    // `data` into it, deallocate `data`, which has room for `capacity` objects, and return the new
+    // storage. If the allocation throws, nothing is changed. The allocator must not customize
+    // `construct` or `destroy`, which are bypassed. Precondition: `size <= new_capacity`
+    template <sane T, class Allocator>
+        requires std::is_move_constructible_v<T>
+              && std::is_same_v<typename std::allocator_traits<Allocator>::value_type, T>
+    constexpr auto grow_storage(
+        Allocator&        allocator,
+        T* const          data,
+        std::size_t const size,
+        std::size_t const capacity,
+        std::size_t const new_capacity) -> T*
+    {
+        using Traits     = std::allocator_traits<Allocator>;
+        T* const storage = Traits::allocate(allocator, new_capacity);
+        if (data != nullptr) {
+            relocate_n(data, size, storage);
+            Traits::deallocate(allocator, data, capacity);
+        }
+        return storage;
+    }
+
     struct Bad_access : std::exception {
         std::source_location source_location;
 
@@ -184,6 +338,16 @@ namespace aa {
         } noexcept -> std::same_as<bool>;
     };
 
+    // The sentinel config promises that `is_sentinel_value` is equivalent to comparing the object
+    // representation with that of `sentinel_value()`, which lets batch algorithms vectorize it.
+    template <class Config, class T>
+    concept bitwise_sentinel_config = requires {
+        requires sentinel_config<Config, T>;
+        requires std::is_same_v<T, decltype(Config::sentinel_value())>;
+        requires std::is_trivially_copyable_v<T>;
+        requires Config::is_bitwise;
+    };
+
     template <class Config>
     concept access_config = requires(bool const has_value) {
         {
@@ -201,7 +365,7 @@ namespace aa {
         {
             if constexpr (do_check) {
                 if (!has_value) {
-                    throw Bad_access { caller };
+                    dtl::throw_bad_access(caller);
                 }
             }
         }
@@ -210,6 +374,49 @@ namespace aa {
     struct Access_config_checked   final : Basic_access_config<true> {};
     struct Access_config_unchecked final : Basic_access_config<false> {};
 
+    // Lets the optimizer assume that every access is valid, so that it can remove the checks of
+    // the caller that precede an access. An invalid access is undefined behavior at run time, and
+    // is rejected in constant evaluation.
+    struct Access_config_assume final {
+        Access_config_assume() = delete;
+        static constexpr auto validate_access(bool const has_value) noexcept -> void
+        {
+            if (!has_value) {
+                std::unreachable();
+            }
+        }
+    };
+
+    // Terminates the program with a trap instruction on invalid access. Cheaper than a checked
+    // access, since there is no exception to construct and no unwinding code in the caller.
+    struct Access_config_trap final {
+        Access_config_trap() = delete;
+        static constexpr auto validate_access(bool const has_value) noexcept -> void
+        {
+            if (!has_value) {
+                dtl::trap();
+            }
+        }
+    };
+
+    // Decides what happens when replacing the active alternative of a `Result` throws. With the
+    // strong guarantee, the replaced alternative is backed up first and restored on failure. With
+    // the basic guarantee, it is destroyed first, and the `Result` holds a value-initialized value
+    // on failure. Replacements that cannot throw always destroy first and construct in place.
+    template <class Config>
+    concept assignment_config = requires {
+        { Config::strong_guarantee } -> std::convertible_to<bool>;
+    };
+
+    template <bool strong>
+    struct Basic_assignment_config {
+        Basic_assignment_config() = delete;
+        static constexpr bool strong_guarantee = strong;
+    };
+
+    struct Assignment_config_strong final : Basic_assignment_config<true> {};
+    struct Assignment_config_basic  final : Basic_assignment_config<false> {};
+
     template <class T>
     struct Sentinel_config_default_for final {
         Sentinel_config_default_for() = delete;
@@ -222,6 +429,7 @@ namespace aa {
     template <class T>
     struct Sentinel_config_default_for<Ref<T>> final {
         Sentinel_config_default_for() = delete;
+        static constexpr bool is_bitwise = true;
         static constexpr auto sentinel_value() noexcept -> Ref<T>
         {
             return Ref<T>::unsafe_construct_null_reference();
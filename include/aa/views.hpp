@@ -0,0 +1,233 @@
+#pragma once
+
+#include <aa/maybe.hpp>
+#include <aa/lazy.hpp>
+#include <aa/utility.hpp>
+#include <functional>
+#include <iterator>
+#include <concepts>
+#include <ranges>
+
+namespace aa::dtl {
+
+    struct Result_has_value {
+        template <lazy_result_like M>
+        [[nodiscard]] constexpr auto operator()(M const& result) const noexcept -> bool
+        {
+            return result.has_value();
+        }
+    };
+
+    struct Result_has_error {
+        template <lazy_result_like M>
+        [[nodiscard]] constexpr auto operator()(M const& result) const noexcept -> bool
+        {
+            return !result.has_value();
+        }
+    };
+
+    struct Maybe_has_value {
+        template <lazy_maybe_like M>
+            requires(!lazy_result_like<M>)
+        [[nodiscard]] constexpr auto operator()(M const& maybe) const noexcept -> bool
+        {
+            return maybe.has_value();
+        }
+    };
+
+    struct Unwrap_value {
+        template <lazy_maybe_like M>
+        [[nodiscard]] constexpr auto operator()(M&& maybe) const
+            -> Unwrap_result<M&&, decltype(std::forward<M>(maybe).unwrap_unchecked())>
+        {
+            return std::forward<M>(maybe).unwrap_unchecked();
+        }
+    };
+
+    struct Unwrap_error {
+        template <lazy_result_like M>
+        [[nodiscard]] constexpr auto operator()(M&& result) const
+            -> Unwrap_result<M&&, decltype(std::forward<M>(result).unwrap_err_unchecked())>
+        {
+            return std::forward<M>(result).unwrap_err_unchecked();
+        }
+    };
+
+    template <class Function, class R>
+    using Filter_map_result
+        = std::remove_cvref_t<std::invoke_result_t<Function&, std::ranges::range_reference_t<R>>>;
+
+} // namespace aa::dtl
+
+namespace aa {
+
+    // The values of the `Maybe` that `function` returns for each element of `V`, skipping the
+    // empty ones. Each `Maybe` is computed once and cached in the view until the iterator moves
+    // on, so this is a single-pass range whose elements are references to the cached value.
+    template <std::ranges::input_range V, class Function>
+        requires std::ranges::view<V> && std::is_object_v<Function>
+              && std::invocable<Function&, std::ranges::range_reference_t<V>>
+              && dtl::lazy_maybe_like<dtl::Filter_map_result<Function, V>&>
+    class Filter_map_view final : public std::ranges::view_interface<Filter_map_view<V, Function>> {
+        using Cached = dtl::Filter_map_result<Function, V>;
+        using Value  = std::remove_cvref_t<decltype(std::declval<Cached&>().unwrap_unchecked())>;
+
+        V m_base = V();
+
+        // Always has a value. `Maybe` can be assigned even if `Function` cannot, as lambdas with
+        // captures cannot, which a view has to be.
+        Maybe<Function> m_function;
+        Cached          m_cached;
+
+        class Iterator final {
+            Filter_map_view*            m_view;
+            std::ranges::iterator_t<V> m_current;
+
+            // Advance to the first element, from the current one, that maps to a value.
+            constexpr auto satisfy() -> void
+            {
+                for (; m_current != std::ranges::end(m_view->m_base); ++m_current) {
+                    m_view->m_cached
+                        = std::invoke(m_view->m_function.unwrap_unchecked(), *m_current);
+                    if (m_view->m_cached.has_value()) {
+                        return;
+                    }
+                }
+            }
+        public:
+            using iterator_concept = std::input_iterator_tag;
+            using value_type       = Value;
+            using difference_type  = std::ranges::range_difference_t<V>;
+
+            constexpr Iterator(Filter_map_view& view, std::ranges::iterator_t<V> current)
+                : m_view { std::addressof(view) }
+                , m_current { std::move(current) }
+            {
+                satisfy();
+            }
+
+            Iterator(Iterator&&)                    = default;
+            auto operator=(Iterator&&) -> Iterator& = default;
+
+            [[nodiscard]] constexpr auto operator*() const noexcept -> Value&
+            {
+                return m_view->m_cached.unwrap_unchecked();
+            }
+
+            constexpr auto operator++() -> Iterator&
+            {
+                ++m_current;
+                satisfy();
+                return *this;
+            }
+
+            constexpr auto operator++(int) -> void
+            {
+                ++*this;
+            }
+
+            [[nodiscard]] constexpr auto operator==(std::default_sentinel_t) const -> bool
+            {
+                return m_current == std::ranges::end(m_view->m_base);
+            }
+        };
+    public:
+        constexpr Filter_map_view()
+            requires std::default_initializable<V> && std::default_initializable<Function>
+            : m_function { in_place }
+        {}
+
+        explicit constexpr Filter_map_view(V base, Function function)
+            : m_base { std::move(base) }
+            , m_function { in_place, std::move(function) }
+        {}
+
+        [[nodiscard]] constexpr auto base() const& -> V
+            requires std::copy_constructible<V>
+        {
+            return m_base;
+        }
+
+        [[nodiscard]] constexpr auto base() && -> V
+        {
+            return std::move(m_base);
+        }
+
+        // Single pass: call once.
+        [[nodiscard]] constexpr auto begin() -> Iterator
+        {
+            return Iterator { *this, std::ranges::begin(m_base) };
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept -> std::default_sentinel_t
+        {
+            return std::default_sentinel;
+        }
+    };
+
+    template <class R, class Function>
+    Filter_map_view(R&&, Function) -> Filter_map_view<std::views::all_t<R>, Function>;
+
+} // namespace aa
+
+namespace aa::dtl {
+
+    template <class Function>
+    struct Filter_map_closure final
+        : std::ranges::range_adaptor_closure<Filter_map_closure<Function>> {
+        Function m_function;
+
+        template <std::ranges::viewable_range R>
+        [[nodiscard]] constexpr auto operator()(R&& range) const
+            -> Filter_map_view<std::views::all_t<R>, Function>
+        {
+            return Filter_map_view<std::views::all_t<R>, Function>(
+                std::views::all(std::forward<R>(range)), m_function);
+        }
+    };
+
+    struct Filter_map_adaptor final {
+        template <std::ranges::viewable_range R, class Function>
+        [[nodiscard]] constexpr auto operator()(R&& range, Function&& function) const
+            -> Filter_map_view<std::views::all_t<R>, std::decay_t<Function>>
+        {
+            return Filter_map_view<std::views::all_t<R>, std::decay_t<Function>>(
+                std::views::all(std::forward<R>(range)), std::forward<Function>(function));
+        }
+
+        template <class Function>
+        [[nodiscard]] constexpr auto operator()(Function&& function) const
+            -> Filter_map_closure<std::decay_t<Function>>
+        {
+            return { {}, std::forward<Function>(function) };
+        }
+    };
+
+} // namespace aa::dtl
+
+// Lazy views over ranges of `Maybe` and `Result`, which compose with the standard views and
+// allocate nothing. `values`, `errors` and `present` are a filter followed by a transform, so
+// on a range of prvalues, such as a `std::views::transform` that returns `Result`, each kept
+// element is computed twice. `filter_map` computes each element once.
+namespace aa::views {
+
+    // The values of the `Result` elements that have one.
+    inline constexpr auto values
+        = std::views::filter(dtl::Result_has_value {})
+        | std::views::transform(dtl::Unwrap_value {});
+
+    // The errors of the `Result` elements that have one.
+    inline constexpr auto errors
+        = std::views::filter(dtl::Result_has_error {})
+        | std::views::transform(dtl::Unwrap_error {});
+
+    // The values of the `Maybe` elements that have one.
+    inline constexpr auto present
+        = std::views::filter(dtl::Maybe_has_value {})
+        | std::views::transform(dtl::Unwrap_value {});
+
+    // `filter_map(function)`: the values of the `Maybe` that `function` returns for each element,
+    // skipping the empty ones.
+    inline constexpr dtl::Filter_map_adaptor filter_map {};
+
+} // namespace aa::views
@@ -0,0 +1,117 @@
+#include <aa/access_stats.hpp>
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <source_location>
+#include <string_view>
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+
+    using Counted = aa::Access_config_counted;
+
+    static_assert(aa::access_config<Counted>);
+    static_assert(!noexcept(Counted::validate_access(true)));
+    static_assert(!noexcept(Maybe<int, Counted, Counted> {}.unwrap()));
+
+    // Accesses in constant evaluation are not counted.
+    STATIC_TEST("Counted access in constant evaluation", {
+        Maybe<int, Counted, Counted> const       a { 10 };
+        Result<int, int, Counted, Counted> const b { aa::in_place, 20 };
+        Result<int, int, Counted, Counted> const c { aa::in_place_error, 30 };
+        return a.unwrap() + *a == 20 && b.unwrap() == 20 && c.unwrap_err() == 30;
+    });
+
+    auto total_hits() -> std::uint64_t
+    {
+        std::uint64_t hits = 0;
+        for (aa::access_stats::Site const& site : aa::access_stats::snapshot()) {
+            hits += site.hits;
+        }
+        return hits;
+    }
+
+    // Accesses from its destructor happen after the table of the thread has been destroyed.
+    struct Access_on_exit {
+        ~Access_on_exit()
+        {
+            static_cast<void>(Maybe<int, Counted, Counted> { 10 }.unwrap());
+        }
+    };
+
+    thread_local Access_on_exit access_on_exit;
+
+    RUNTIME_TEST("Accesses during thread exit are counted", {
+        std::uint64_t const before = total_hits();
+        std::thread         thread { [] {
+            // Constructed before the table, so destroyed after it.
+            static_cast<void>(&access_on_exit);
+            static_cast<void>(Maybe<int, Counted, Counted> { 20 }.unwrap());
+        } };
+        thread.join();
+        return total_hits() == before + 2;
+    });
+
+    // Counts an access at the call site.
+    auto s(std::source_location const caller = std::source_location::current()) -> int
+    {
+        static_cast<void>(Maybe<int, Counted, Counted> { 1 }.unwrap(caller));
+        return 1;
+    }
+
+    // Accesses from more call sites than the table of a thread holds, one site per column.
+    auto access_from_many_sites() -> std::size_t
+    {
+        int const accesses[] { // NOLINT: C array, to count the call sites
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+            s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(), s(),
+        };
+        return std::size(accesses);
+    }
+
+    RUNTIME_TEST("Accesses from call sites that do not fit in the table are counted", {
+        std::uint64_t const before = total_hits();
+        std::size_t         count  = 0;
+        std::thread         thread { [&] { count = access_from_many_sites(); } };
+        thread.join();
+        bool const overflowed = std::ranges::any_of(
+            aa::access_stats::snapshot(), [](aa::access_stats::Site const& site) {
+                return std::string_view(site.file_name) == "<other call sites>";
+            });
+        return count > 512 && overflowed && total_hits() == before + count;
+    });
+
+} // namespace
@@ -0,0 +1,27 @@
+#include <aa/arena.hpp>
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <memory_resource>
+#include <string>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+
+    STATIC_TEST("Null sentinel", {
+        Maybe<aa::Arena_ref<int>> const a;
+        return a.is_empty();
+    });
+
+    static_assert(aa::sane<aa::Arena_ref<std::pmr::string>>);
+    static_assert(std::is_trivially_copyable_v<aa::Arena_ref<int>>);
+    static_assert(std::is_convertible_v<aa::Arena_ref<int>, aa::Arena_ref<int const>>);
+    static_assert(!std::is_convertible_v<aa::Arena_ref<int const>, aa::Arena_ref<int>>);
+    static_assert(!std::is_constructible_v<aa::Arena_ref<int>, int&>);
+
+    // The null sentinel makes `Maybe` exactly as large as a pointer.
+    static_assert(sizeof(Maybe<aa::Arena_ref<std::pmr::string>>) == sizeof(void*));
+    static_assert(sizeof(Result<aa::Arena_ref<std::pmr::string>, int>) == 2 * sizeof(void*));
+
+} // namespace
@@ -0,0 +1,69 @@
+#include <aa/atomic_maybe.hpp>
+#include <aa/sentinel.hpp>
+#include <aa/maybe.hpp>
+#include <cstdint>
+#include <memory>
+#include "test_utility.hpp"
+
+namespace {
+
+    using aa::nothing;
+
+    using Slot = aa::Atomic_maybe<std::uint64_t, aa::Sentinel_int<std::uint64_t>>;
+
+    // Emptiness costs no space: the state is a single atomic word.
+    static_assert(sizeof(Slot) == sizeof(std::uint64_t));
+    static_assert(sizeof(aa::Atomic_maybe<double, aa::Sentinel_nan<double>>) == sizeof(double));
+    static_assert(sizeof(aa::Atomic_maybe<aa::Ref<int>>) == sizeof(int*));
+
+    // The atomic compares object representations, so the sentinel has to be bitwise.
+    template <class T, class Config>
+    concept atomic_maybe_with = requires { typename aa::Atomic_maybe<T, Config>; };
+    static_assert(atomic_maybe_with<int*, aa::Sentinel_null<int*>>);
+    static_assert(!atomic_maybe_with<
+                  std::unique_ptr<int>,
+                  aa::Sentinel_null<std::unique_ptr<int>>>);
+
+    STATIC_TEST("Empty by default", {
+        Slot const slot;
+        return !slot.has_value() && slot.load().is_empty();
+    });
+
+    STATIC_TEST("Publish", {
+        Slot       slot;
+        bool const first  = slot.try_publish(10);
+        bool const second = slot.try_publish(20);
+        return first && !second && slot.load().unwrap() == 10;
+    });
+
+    STATIC_TEST("Take", {
+        Slot       slot { 10 };
+        auto const first  = slot.take();
+        auto const second = slot.take();
+        return first.unwrap() == 10 && second.is_empty() && !slot.has_value();
+    });
+
+    STATIC_TEST("Publish after take", {
+        Slot slot { 10 };
+        (void)slot.take();
+        return slot.try_publish(20) && slot.take().unwrap() == 20;
+    });
+
+    STATIC_TEST("Exchange", {
+        Slot       slot;
+        auto const empty   = slot.exchange(10);
+        auto const ten     = slot.exchange(nothing);
+        auto const emptied = slot.exchange(30);
+        return empty.is_empty() && ten.unwrap() == 10 && emptied.is_empty()
+            && slot.load().unwrap() == 30;
+    });
+
+    STATIC_TEST("Store", {
+        Slot slot;
+        slot.store(10);
+        bool const stored = slot.load().unwrap() == 10;
+        slot.store(nothing);
+        return stored && !slot.has_value();
+    });
+
+} // namespace
@@ -0,0 +1,64 @@
+#include <aa/box.hpp>
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <array>
+#include <string>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+    using namespace aa::tests;
+
+    struct Big_error {
+        std::array<char, 256> message {};
+    };
+
+    STATIC_TEST("Construction and access", {
+        Box<Nontrivial>       a { aa::in_place, 10 };
+        Box<Nontrivial> const b { aa::in_place, 20 };
+        a->integer += 1;
+        return a->integer == 11 && (*b).integer == 20;
+    });
+
+    STATIC_TEST("Copy is deep", {
+        Box<std::string> const a { aa::in_place, "hello" };
+        Box<std::string>       b = a;
+        *b += " world";
+        return *a == "hello" && *b == "hello world" && a.get() != b.get();
+    });
+
+    STATIC_TEST("Move leaves the source null", {
+        Box<int> a { aa::in_place, 10 };
+        Box<int> b = std::move(a);
+        Box<int> c { aa::in_place, 20 };
+        c          = std::move(b);
+        return a.get() == nullptr && b.get() == nullptr && *c == 10; // NOLINT: use after move
+    });
+
+    STATIC_TEST("Null sentinel", {
+        Maybe<Box<int>> a;
+        Maybe<Box<int>> b { Box<int> { aa::in_place, 10 } };
+        bool const before = a.is_empty() && **b == 10;
+        a                 = std::move(b);
+        b.reset();
+        return before && **a == 10 && b.is_empty();
+    });
+
+    STATIC_TEST("Boxed error", {
+        Result<int, Box<Big_error>> const a { 10 };
+        Result<int, Box<Big_error>> const b { aa::in_place_error, aa::in_place };
+        return a.unwrap() == 10 && b.unwrap_err()->message[0] == '\0';
+    });
+
+    static_assert(aa::sane<Box<std::string>>);
+    static_assert(aa::trivially_relocatable<Box<std::string>>);
+
+    // The null sentinel makes `Maybe` exactly as large as a pointer.
+    static_assert(sizeof(Maybe<Box<Big_error>>) == sizeof(void*));
+
+    // Boxing a large error keeps the `Result` as small as its value and a flag.
+    static_assert(sizeof(Result<int, Box<Big_error>>) == 2 * sizeof(void*));
+    static_assert(sizeof(Result<int, Big_error>) > sizeof(Big_error));
+
+} // namespace
@@ -0,0 +1,130 @@
+#include <aa/coroutine.hpp>
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <coroutine>
+#include <stdexcept>
+#include <string>
+#include "test_utility.hpp"
+
+// Coroutines cannot be evaluated at compile time, so what can be awaited where, and what
+// `co_await` gives, are checked statically, and the coroutines themselves at run time.
+
+namespace {
+
+    using namespace aa::basics;
+    using namespace aa::tests;
+
+    template <class Return>
+    using Promise = typename std::coroutine_traits<Return>::promise_type;
+
+    template <class Return, class M>
+    concept awaitable_in = requires(Promise<Return>& promise, M&& awaited) {
+        promise.await_transform(std::forward<M>(awaited));
+    };
+
+    template <class Return, class M>
+    using Await_result = decltype(std::declval<Promise<Return>&>()
+                                      .await_transform(std::declval<M>())
+                                      .await_resume());
+
+    static_assert(std::is_same_v<Promise<Maybe<int>>, aa::dtl::Coroutine_promise<Maybe<int>>>);
+    static_assert(std::is_same_v<
+                  Promise<Result<int, std::string>>,
+                  aa::dtl::Coroutine_promise<Result<int, std::string>>>);
+
+    // `Maybe` is awaited in a `Maybe` coroutine, and `Result` in a `Result` coroutine whose error
+    // can hold the awaited error.
+    static_assert(awaitable_in<Maybe<int>, Maybe<std::string>>);
+    static_assert(awaitable_in<Result<int, std::string>, Result<double, std::string>>);
+    static_assert(awaitable_in<Result<int, long>, Result<int, int>>);
+    static_assert(!awaitable_in<Result<int, int>, Result<int, std::string>>);
+    static_assert(!awaitable_in<Result<int, int>, Maybe<int>>);
+    static_assert(!awaitable_in<Maybe<int>, Result<int, int>>);
+    static_assert(!awaitable_in<Maybe<int>, int>);
+
+    // Awaiting an lvalue gives a reference into it. Awaiting an rvalue moves the value out.
+    static_assert(std::is_same_v<Await_result<Maybe<int>, Maybe<std::string>&>, std::string&>);
+    static_assert(std::is_same_v<
+                  Await_result<Maybe<int>, Maybe<std::string> const&>,
+                  std::string const&>);
+    static_assert(std::is_same_v<Await_result<Maybe<int>, Maybe<std::string>>, std::string>);
+    static_assert(std::is_same_v<
+                  Await_result<Result<int, int>, Result<std::string, int>>,
+                  std::string>);
+
+    // The parameter is copied into the frame, so `destructions` counts 2 once the frame is gone.
+    auto halve_twice(int const value, Destruction_counter const counter) -> Maybe<int>
+    {
+        static_cast<void>(counter);
+        auto const halve = [](int const x) -> Maybe<int> {
+            if (x % 2 != 0) {
+                return nothing;
+            }
+            return x / 2;
+        };
+        int const half = co_await halve(value);
+        co_return co_await halve(half);
+    }
+
+    using Parsed = Result<int, std::string>;
+
+    auto parse_digit(char const digit) -> Parsed
+    {
+        if (digit < '0' || digit > '9') {
+            return Error { std::string { "not a digit" } };
+        }
+        return digit - '0';
+    }
+
+    auto parse_number(std::string const& digits, Destruction_counter const counter) -> Parsed
+    {
+        static_cast<void>(counter);
+        int number = 0;
+        for (char const digit : digits) {
+            if (digit == '!') {
+                throw std::invalid_argument { "thrown" };
+            }
+            number = number * 10 + co_await parse_digit(digit);
+        }
+        co_return number;
+    }
+
+    RUNTIME_TEST("Maybe coroutine returns", {
+        int              destructions = 0;
+        Maybe<int> const result       = halve_twice(12, Destruction_counter { destructions });
+        return result.unwrap() == 3 && destructions == 2;
+    });
+
+    RUNTIME_TEST("Maybe coroutine returns early on nothing", {
+        int              destructions = 0;
+        Maybe<int> const first        = halve_twice(7, Destruction_counter { destructions });
+        Maybe<int> const second       = halve_twice(6, Destruction_counter { destructions });
+        return first.is_empty() && second.is_empty() && destructions == 4;
+    });
+
+    RUNTIME_TEST("Result coroutine returns", {
+        int          destructions = 0;
+        Parsed const result       = parse_number("123", Destruction_counter { destructions });
+        return result.unwrap() == 123 && destructions == 2;
+    });
+
+    RUNTIME_TEST("Result coroutine returns early on error", {
+        int          destructions = 0;
+        Parsed const result       = parse_number("1x!", Destruction_counter { destructions });
+        return result.unwrap_err() == "not a digit" && destructions == 2;
+    });
+
+    RUNTIME_TEST("Exceptions propagate and destroy the frame", {
+        int  destructions = 0;
+        bool caught       = false;
+        try {
+            static_cast<void>(parse_number("12!", Destruction_counter { destructions }));
+        }
+        catch (std::invalid_argument const&) {
+            caught = true;
+        }
+        Parsed const after = parse_number("4", Destruction_counter { destructions });
+        return caught && destructions == 4 && after.unwrap() == 4;
+    });
+
+} // namespace
@@ -0,0 +1,95 @@
+#include <aa/inline_vector.hpp>
+#include <string>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+    using namespace aa::tests;
+
+    // Only trivial elements can be stored in a vector in constant evaluation.
+    STATIC_TEST("Push and access", {
+        Inline_vector<int, 4> v;
+        bool const pushed = v.try_push_back(10).has_value() && v.try_emplace_back(20).has_value();
+        return pushed && v.size() == 2 && v[0] == 10 && v[1] == 20;
+    });
+
+    RUNTIME_TEST("Push and access nontrivial elements", {
+        Inline_vector<Nontrivial, 4> v;
+        bool const pushed
+            = v.try_push_back(Nontrivial { 10 }).has_value() && v.try_emplace_back(20).has_value();
+        return pushed && v.size() == 2 && v[0].integer == 10 && v[1].integer == 20;
+    });
+
+    STATIC_TEST("Pushing to a full vector fails", {
+        Inline_vector<int, 2> v;
+        bool const pushed = v.try_push_back(1).has_value() && v.try_push_back(2).has_value();
+        return pushed && v.is_full() && v.try_push_back(3).is_empty() && v.size() == 2;
+    });
+
+    RUNTIME_TEST("try_emplace_back refers to the new element", {
+        Inline_vector<Nontrivial, 2> v;
+        v.try_emplace_back(10).unwrap()->integer = 20;
+        return v[0].integer == 20;
+    });
+
+    RUNTIME_TEST("pop_back", {
+        Inline_vector<Nontrivial, 2> v;
+        static_cast<void>(v.try_emplace_back(10));
+        Maybe<Nontrivial> const a = v.pop_back();
+        Maybe<Nontrivial> const b = v.pop_back();
+        return a.unwrap().integer == 10 && b.is_empty() && v.is_empty();
+    });
+
+    STATIC_TEST("Iteration", {
+        Inline_vector<int, 8> v;
+        for (int i = 1; i <= 4; ++i) {
+            static_cast<void>(v.try_push_back(i));
+        }
+        int sum = 0;
+        for (int const x : v) {
+            sum += x;
+        }
+        return sum == 10 && v.end() - v.begin() == 4;
+    });
+
+    RUNTIME_TEST("Copy and move", {
+        Inline_vector<std::string, 4> a;
+        static_cast<void>(a.try_emplace_back("hello"));
+        static_cast<void>(a.try_emplace_back("world"));
+        Inline_vector<std::string, 4> b = a;
+        Inline_vector<std::string, 4> c = std::move(a);
+        return b.size() == 2 && b[1] == "world" && c.size() == 2 && c[0] == "hello";
+    });
+
+    RUNTIME_TEST("Assignment grows and shrinks", {
+        Inline_vector<Nontrivial, 4> a;
+        Inline_vector<Nontrivial, 4> b;
+        static_cast<void>(a.try_emplace_back(1));
+        static_cast<void>(b.try_emplace_back(2));
+        static_cast<void>(b.try_emplace_back(3));
+        a = b;
+        bool const grown = a.size() == 2 && a[0].integer == 2 && a[1].integer == 3;
+        b.clear();
+        static_cast<void>(b.try_emplace_back(4));
+        a = std::move(b);
+        return grown && a.size() == 1 && a[0].integer == 4;
+    });
+
+    STATIC_TEST("Trivial copy", {
+        Inline_vector<int, 4> a;
+        static_cast<void>(a.try_push_back(1));
+        static_cast<void>(a.try_push_back(2));
+        Inline_vector<int, 4> const b = a;
+        return b.size() == 2 && b[0] == 1 && b[1] == 2;
+    });
+
+    static_assert(std::is_trivially_copyable_v<Inline_vector<int, 16>>);
+    static_assert(!std::is_trivially_copyable_v<Inline_vector<std::string, 16>>);
+    static_assert(aa::trivially_relocatable<Inline_vector<Relocatable, 16>>);
+
+    // The size is stored in the smallest type that can represent the capacity.
+    static_assert(sizeof(Inline_vector<std::uint8_t, 16>) == 17);
+    static_assert(sizeof(Inline_vector<int, 16>) == 17 * sizeof(int));
+
+} // namespace
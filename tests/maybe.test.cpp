@@ -1,4 +1,6 @@
 #include <aa/maybe.hpp>
+#include <cstdint>
+#include <ranges>
 #include <string>
 #include "test_utility.hpp"
 
@@ -155,6 +157,108 @@ namespace {
         return a.is_empty() && b->integer == 11;
     });
 
+    STATIC_TEST("map elides the result", {
+        int              moves = 0;
+        Maybe<int> const a { 10 };
+
+        auto const b = a.map([&moves](int) { return Move_counter { moves }; });
+        auto const c = a.map([](int const x) { return Immovable { x }; });
+        return b.has_value() && moves == 0 && c->integer == 10;
+    });
+
+    STATIC_TEST("In-place invoke construction", {
+        int        moves   = 0;
+        auto const counter = [&moves] { return Move_counter { moves }; };
+        auto const make    = [](int const x) { return Immovable { x }; };
+
+        Maybe<Move_counter> const a { aa::in_place_invoke, counter };
+        Maybe<Immovable> const    b { aa::in_place_invoke, make, 10 };
+        return a.has_value() && moves == 0 && b->integer == 10;
+    });
+
+    STATIC_TEST("emplace_with", {
+        int                 moves = 0;
+        Maybe<Move_counter> a;
+        Maybe<Immovable>    b { aa::in_place, 10 };
+
+        a.emplace_with([&moves] { return Move_counter { moves }; });
+        a.emplace_with([&moves] { return Move_counter { moves }; });
+        b.emplace_with([](int const x) { return Immovable { x }; }, 20);
+        return a.has_value() && moves == 0 && b->integer == 20;
+    });
+
+    STATIC_TEST("Assigning an empty Maybe destroys the value", {
+        int                              destructions = 0;
+        Maybe<Destruction_counter>       a { aa::in_place, destructions };
+        Maybe<Destruction_counter> const b;
+        a = b;
+        return a.is_empty() && destructions == 1;
+    });
+
+    STATIC_TEST("Access with the assume and trap configs", {
+        using Assume = aa::Access_config_assume;
+        using Trap   = aa::Access_config_trap;
+        Maybe<int, Assume, Assume> const a { 10 };
+        Maybe<int, Trap, Trap> const     b { 20 };
+        return a.unwrap() + *a == 20 && b.unwrap() + *b == 40;
+    });
+
+    STATIC_TEST("Non-sentinel range", {
+        Maybe<std::string> maybe { "hello" };
+        Maybe<std::string> empty;
+        for (std::string& value : maybe) {
+            value += " world";
+        }
+        return maybe.size() == 1 && empty.size() == 0 && *maybe.begin() == "hello world"
+            && maybe.end() - maybe.begin() == 1 && empty.begin() == empty.end();
+    });
+
+    STATIC_TEST("Sentinel range", {
+        Maybe<Nontrivial_with_sentinel> const maybe { Nontrivial { 10 } };
+        Maybe<Nontrivial_with_sentinel> const empty;
+        int                                   sum = 0;
+        for (Nontrivial_with_sentinel const& value : maybe) {
+            sum += value.integer;
+        }
+        for (Nontrivial_with_sentinel const& value : empty) {
+            sum += value.integer;
+        }
+        return sum == 10 && maybe.size() == 1 && empty.size() == 0;
+    });
+
+    STATIC_TEST("Lazy pipeline", {
+        Maybe<int> const a { 10 };
+        Maybe<int> const b;
+
+        auto const twice    = [](int const x) { return x * 2; };
+        auto const positive = [](int const x) -> Maybe<int> {
+            if (x > 0) {
+                return x;
+            }
+            return nothing;
+        };
+
+        return a.lazy().map(twice).and_then(positive).value_or(0) == 20
+            && b.lazy().map(twice).or_else([] { return Maybe<int> { 5 }; }).value_or(0) == 5
+            && a.lazy().map([](int const x) { return -x; }).and_then(positive).evaluate().is_empty()
+            && b.lazy().map(twice).evaluate().is_empty();
+    });
+
+    STATIC_TEST("Lazy pipeline constructs no intermediate Maybe", {
+        int                 moves = 0;
+        Maybe<Move_counter> a { aa::in_place, moves };
+
+        auto const step = [](Move_counter&& counter) { return std::move(counter); };
+
+        int                 eager_moves = 0;
+        Maybe<Move_counter> c { aa::in_place, eager_moves };
+
+        // One move per step, like the eager chain. The last step constructs its result in place.
+        Maybe<Move_counter> const b = std::move(a).lazy().map(step).map(step).map(step).evaluate();
+        Maybe<Move_counter> const d = std::move(c).map(step).map(step).map(step);
+        return b.has_value() && d.has_value() && moves == 3 && eager_moves == 3;
+    });
+
     static_assert(requires(Maybe<Nontrivial> m, Maybe<Nontrivial> const c) {
         // clang-format off
         { m.unwrap() }                -> std::same_as<Nontrivial&>;
@@ -204,4 +308,21 @@ namespace {
     // When `T` has a sentinel value, `Maybe<T>` is merely a value wrapper.
     static_assert(sizeof(Maybe<Nontrivial_with_sentinel>) == sizeof(Nontrivial_with_sentinel));
 
+    // Small maybes with trivial values are trivially copyable, and returned in registers.
+    static_assert(std::is_trivially_copyable_v<Maybe<int>>);
+    static_assert(register_passable<Maybe<int>>);
+    static_assert(register_passable<Maybe<std::uint64_t>>);
+    static_assert(register_passable<Maybe<aa::Ref<int>>>);
+    static_assert(!std::is_trivially_copy_assignable_v<Maybe<Destruction_counter>>);
+
+    // `Maybe` is a contiguous range of zero or one elements.
+    static_assert(std::ranges::contiguous_range<Maybe<int>>);
+    static_assert(std::ranges::sized_range<Maybe<std::string> const>);
+    static_assert(std::is_same_v<std::ranges::range_reference_t<Maybe<int> const>, int const&>);
+
+    // `Maybe` is trivially relocatable if and only if its value is.
+    static_assert(aa::trivially_relocatable<Maybe<int>>);
+    static_assert(aa::trivially_relocatable<Maybe<Relocatable>>);
+    static_assert(!aa::trivially_relocatable<Maybe<Nontrivial>>);
+
 } // namespace
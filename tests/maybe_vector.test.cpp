@@ -0,0 +1,153 @@
+#include <aa/maybe_vector.hpp>
+#include <string>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+    using namespace aa::tests;
+
+    STATIC_TEST("Bitmap push and access", {
+        Maybe_vector<Nontrivial> v;
+        v.push_back(Nontrivial { 10 });
+        v.push_back(nothing);
+        v.emplace_back(30);
+        return v.size() == 3 && v[0].unwrap()->integer == 10 && v[1].is_empty()
+            && v[2].unwrap()->integer == 30;
+    });
+
+    STATIC_TEST("Sentinel push and access", {
+        Maybe_vector<Nontrivial_with_sentinel> v;
+        v.push_back(Nontrivial { 10 });
+        v.push_back(nothing);
+        v.emplace_back(Nontrivial { 30 });
+        return v.size() == 3 && v[0].unwrap()->integer == 10 && v[1].is_empty()
+            && v[2].unwrap()->integer == 30;
+    });
+
+    STATIC_TEST("Bitmap growth preserves values", {
+        Maybe_vector<Nontrivial> v;
+        for (int i = 0; i != 200; ++i) {
+            if (i % 3 == 0) {
+                v.emplace_back(i);
+            }
+            else {
+                v.push_back(nothing);
+            }
+        }
+        for (int i = 0; i != 200; ++i) {
+            auto const element = v[static_cast<std::size_t>(i)];
+            if ((i % 3 == 0) != element.has_value()) {
+                return false;
+            }
+            if (element.has_value() && element.unwrap()->integer != i) {
+                return false;
+            }
+        }
+        return v.count() == 67;
+    });
+
+    STATIC_TEST("Bitmap find_next_present across words", {
+        Maybe_vector<int> v;
+        for (int i = 0; i != 150; ++i) {
+            v.push_back(nothing);
+        }
+        v.emplace(3, 3);
+        v.emplace(64, 64);
+        v.emplace(149, 149);
+        return v.find_next_present().unwrap() == 3 && v.find_next_present(4).unwrap() == 64
+            && v.find_next_present(65).unwrap() == 149 && v.find_next_present(150).is_empty()
+            && v.count() == 3;
+    });
+
+    STATIC_TEST("Sentinel find_next_present", {
+        Maybe_vector<Nontrivial_with_sentinel> v;
+        v.push_back(nothing);
+        v.push_back(Nontrivial { 5 });
+        v.push_back(nothing);
+        return v.find_next_present().unwrap() == 1 && v.find_next_present(2).is_empty()
+            && v.count() == 1;
+    });
+
+    STATIC_TEST("Bitmap emplace and reset", {
+        Maybe_vector<Nontrivial> v;
+        v.push_back(nothing);
+        v.emplace_back(20);
+        v.emplace(0, 10);
+        v.reset(1);
+        return v[0].unwrap()->integer == 10 && v[1].is_empty() && v.count() == 1;
+    });
+
+    STATIC_TEST("Sentinel emplace and reset", {
+        Maybe_vector<Nontrivial_with_sentinel> v;
+        v.push_back(nothing);
+        v.push_back(Nontrivial { 20 });
+        v.emplace(0, Nontrivial { 10 });
+        v.reset(1);
+        return v[0].unwrap()->integer == 10 && v[1].is_empty() && v.count() == 1;
+    });
+
+    STATIC_TEST("Bitmap pop_back and clear", {
+        Maybe_vector<Nontrivial> v;
+        v.emplace_back(10);
+        v.emplace_back(20);
+        v.pop_back();
+        bool const popped = v.size() == 1 && v.count() == 1;
+        v.clear();
+        return popped && v.is_empty() && v.count() == 0 && v.find_next_present().is_empty();
+    });
+
+    STATIC_TEST("Bitmap copy and move", {
+        Maybe_vector<Nontrivial> a;
+        a.emplace_back(10);
+        a.push_back(nothing);
+        Maybe_vector<Nontrivial>       b { a };
+        Maybe_vector<Nontrivial> const c { std::move(a) };
+        b[0].unwrap()->integer = 11;
+        return a.is_empty() && b[0].unwrap()->integer == 11 && c[0].unwrap()->integer == 10
+            && c[1].is_empty();
+    });
+
+    STATIC_TEST("Mutation through element references", {
+        Maybe_vector<Nontrivial> v;
+        v.emplace_back(10);
+        v[0].unwrap()->integer = 20;
+        return v[0].unwrap()->integer == 20;
+    });
+
+    STATIC_TEST("for_each_present", {
+        Maybe_vector<int> v;
+        for (int i = 0; i != 100; ++i) {
+            if (i % 2 == 0) {
+                v.push_back(i);
+            }
+            else {
+                v.push_back(nothing);
+            }
+        }
+        int sum {};
+        v.for_each_present([&](std::size_t const index, int const value) {
+            sum += value * static_cast<int>(index == static_cast<std::size_t>(value));
+        });
+        return sum == 2450;
+    });
+
+    static_assert(requires(Maybe_vector<Nontrivial> m, Maybe_vector<Nontrivial> const c) {
+        // clang-format off
+        { m[0] } -> std::same_as<Maybe<aa::Ref<Nontrivial>>>;
+        { c[0] } -> std::same_as<Maybe<aa::Ref<Nontrivial const>>>;
+        // clang-format on
+    });
+
+    // Element references use the null sentinel of `Ref`, so they are pointer-sized.
+    static_assert(sizeof(Maybe<aa::Ref<std::string>>) == sizeof(std::string*));
+
+    // With a sentinel value, there is no separate presence bitmap.
+    static_assert(
+        sizeof(Maybe_vector<Nontrivial_with_sentinel>)
+        == sizeof(std::vector<Nontrivial_with_sentinel>));
+
+    static_assert(std::is_nothrow_move_constructible_v<Maybe_vector<std::string>>);
+    static_assert(std::is_copy_constructible_v<Maybe_vector<std::string>>);
+
+} // namespace
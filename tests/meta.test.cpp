@@ -1,5 +1,6 @@
 #include <aa/meta.hpp>
 #include <tuple>
+#include <utility>
 
 using namespace aa::meta;
 
@@ -18,3 +19,49 @@ static_assert(!Any<std::is_reference, int, float>::value);
 static_assert(All<std::is_reference, int&, float&>::value);
 static_assert(!All<std::is_reference, int, float&>::value);
 static_assert(!All<std::is_reference, int, float>::value);
+
+static_assert(std::is_same_v<typename Concat<>::type, List<>>);
+static_assert(std::is_same_v<
+              typename Concat<List<int>, List<>, List<float, char>>::type,
+              List<int, float, char>>);
+
+static_assert(Contains<int, List<float, int>>::value);
+static_assert(!Contains<int, List<float, int const>>::value);
+static_assert(!Contains<int, List<>>::value);
+
+static_assert(Index_of<int, List<int, float>>::value == 0);
+static_assert(Index_of<float, List<int, float, float>>::value == 1);
+template <class T, class L>
+concept has_index_of = requires { Index_of<T, L>::value; };
+static_assert(!has_index_of<char, List<int, float>>);
+
+static_assert(std::is_same_v<typename At<0, List<int, float, char>>::type, int>);
+static_assert(std::is_same_v<typename At<2, List<int, float, char>>::type, char>);
+static_assert(std::is_same_v<typename At<1, List<int, int&, int>>::type, int&>);
+template <std::size_t index, class L>
+concept has_element_at = requires { typename At<index, L>::type; };
+static_assert(!has_element_at<3, List<int, float, char>>);
+
+static_assert(std::is_same_v<
+              typename Filter<std::is_reference, List<int, float&, char, int&&>>::type,
+              List<float&, int&&>>);
+static_assert(std::is_same_v<typename Filter<std::is_reference, List<int>>::type, List<>>);
+
+static_assert(std::is_same_v<
+              typename Unique<List<int, float, int, char, float>>::type,
+              List<int, float, char>>);
+static_assert(std::is_same_v<typename Unique<List<>>::type, List<>>);
+
+// Lists longer than a compiler's limit on the operands of a fold.
+template <std::size_t>
+struct Type {};
+template <std::size_t... indices>
+auto make_types(std::index_sequence<indices...>) -> List<Type<indices>...>;
+using Long = decltype(make_types(std::make_index_sequence<300> {}));
+
+static_assert(Contains<Type<299>, Long>::value);
+static_assert(!Contains<Type<300>, Long>::value);
+static_assert(
+    std::is_same_v<typename Apply<Concat, typename Map<List, Long>::type>::type::type, Long>);
+static_assert(std::is_same_v<typename Filter<std::is_class, Long>::type, Long>);
+static_assert(std::is_same_v<typename Unique<Long>::type, Long>);
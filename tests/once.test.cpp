@@ -0,0 +1,72 @@
+#include <aa/once.hpp>
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <string>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+
+    // Not movable, so it can only be initialized by eliding the result of the function.
+    struct Immovable {
+        int integer {};
+
+        explicit constexpr Immovable(int const integer) noexcept : integer { integer } {}
+
+        Immovable(Immovable&&) = delete;
+    };
+
+    STATIC_TEST("Empty until initialized", {
+        aa::Once<std::string> once;
+        return once.get().is_empty();
+    });
+
+    STATIC_TEST("Initialized once", {
+        aa::Once<std::string> once;
+        int                   calls = 0;
+        auto const            init  = [&] {
+            ++calls;
+            return std::string(100, 'x');
+        };
+        std::string& first  = once.get_or_init(init);
+        std::string& second = once.get_or_init(init);
+        return calls == 1 && &first == &second && first.size() == 100
+            && once.get().unwrap()->size() == 100;
+    });
+
+    STATIC_TEST("The result of the function is elided", {
+        aa::Once<Immovable> once;
+        return once.get_or_init([] { return Immovable { 10 }; }).integer == 10;
+    });
+
+    STATIC_TEST("Try init", {
+        aa::Once<int> once;
+        auto const    init = [] -> Result<int, std::string> { return 10; };
+        return once.get_or_try_init(init).unwrap() == 10 && once.get().unwrap() == 10;
+    });
+
+    STATIC_TEST("An error does not poison the cell", {
+        aa::Once<int> once;
+        auto const    fail = [] -> Result<int, std::string> {
+            return Error { std::string(100, 'e') };
+        };
+        auto const succeed = [] -> Result<int, std::string> { return 20; };
+        bool const failed  = once.get_or_try_init(fail).unwrap_err().size() == 100;
+        bool const empty   = once.get().is_empty();
+        return failed && empty && once.get_or_try_init(succeed).unwrap() == 20
+            && once.get_or_try_init(fail).unwrap() == 20;
+    });
+
+    STATIC_TEST("Try init after init", {
+        aa::Once<int> once;
+        once.get_or_init([] { return 30; });
+        int        calls = 0;
+        auto const init  = [&] -> Result<int, int> {
+            ++calls;
+            return 40;
+        };
+        return once.get_or_try_init(init).unwrap() == 30 && calls == 0;
+    });
+
+} // namespace
@@ -0,0 +1,59 @@
+#include <aa/optimal_layout.hpp>
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <cstdint>
+#include <string>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+    using aa::meta::List;
+    using aa::meta::Optimal_layout;
+
+    struct Empty {};
+
+    using Members = List<Maybe<std::uint8_t>, Maybe<double>, Maybe<std::uint8_t>, Ref<int>>;
+    using Record  = Optimal_layout<Members>;
+
+    struct Declaration_order {
+        Maybe<std::uint8_t> a;
+        Maybe<double>       b;
+        Maybe<std::uint8_t> c;
+        Ref<int>            d;
+    };
+
+    // Sorted by alignment, the members need no padding between them.
+    static_assert(sizeof(Record) == 32);
+    static_assert(sizeof(Declaration_order) == 40);
+    static_assert(std::is_trivially_copyable_v<Record>);
+
+    static_assert(Record::slot(1) == 0 && Record::slot(3) == 1);
+    static_assert(Record::slot(0) == 2 && Record::slot(2) == 3);
+
+    static_assert(sizeof(Optimal_layout<List<char, Result<int, int>, char, Empty>>) == 12);
+    static_assert(!std::is_trivially_copyable_v<Optimal_layout<List<int, std::string>>>);
+
+    static_assert(std::is_same_v<std::tuple_element_t<3, Record>, Ref<int>>);
+    static_assert(std::tuple_size_v<Record> == 4);
+
+    STATIC_TEST("Members are accessed by their declared index", {
+        int          integer = 10;
+        Record const record { std::uint8_t { 1 }, 2.5, nothing, Ref { integer } };
+        return record.get<0>().unwrap() == 1 && record.get<1>().unwrap() == 2.5
+            && record.get<2>().is_empty() && *record.get<3>() == 10;
+    });
+
+    STATIC_TEST("Structured bindings", {
+        Optimal_layout<List<char, std::string, int>> record { 'a', "hello", 10 };
+        auto& [c, s, i] = record;
+        s += " world";
+        return c == 'a' && record.get<1>() == "hello world" && i == 10;
+    });
+
+    STATIC_TEST("Value initialization", {
+        Optimal_layout<List<int, double, Maybe<int>>> const record {};
+        return record.get<0>() == 0 && record.get<1>() == 0.0 && record.get<2>().is_empty();
+    });
+
+} // namespace
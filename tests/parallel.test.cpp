@@ -0,0 +1,73 @@
+#include <aa/parallel.hpp>
+#include <aa/result.hpp>
+#include <string>
+#include <vector>
+#include <array>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+
+    // Negative inputs are invalid.
+    constexpr auto parse(int const input) -> Result<int, std::string>
+    {
+        if (input < 0) {
+            return Error { "negative " + std::string(static_cast<std::size_t>(-input), '-') };
+        }
+        return input * 2;
+    }
+
+    constexpr auto to_string(int const input) -> Result<std::string, int>
+    {
+        if (input < 0) {
+            return Error { input };
+        }
+        return std::string(static_cast<std::size_t>(input), 'x');
+    }
+
+    constexpr auto plus = [](int const a, int const b) { return a + b; };
+
+    STATIC_TEST("Transform reduce", {
+        std::array const inputs { 1, 2, 3, 4 };
+        return aa::try_transform_reduce(inputs, 100, plus, parse).unwrap() == 120;
+    });
+
+    STATIC_TEST("Transform reduce stops at the first error", {
+        std::array const inputs { 1, -2, 3, -4 };
+        return aa::try_transform_reduce(inputs, 0, plus, parse).unwrap_err() == "negative --";
+    });
+
+    STATIC_TEST("Transform reduce of an empty range", {
+        std::vector<int> const inputs;
+        return aa::try_transform_reduce(inputs, 5, plus, parse).unwrap() == 5;
+    });
+
+    STATIC_TEST("Transform reduce in order", {
+        std::array const inputs { 1, 2, 3 };
+        auto const       concatenate = [](std::string a, std::string const& b) { return a + b; };
+        auto const       digit = [](int const input) -> Result<std::string, int> {
+            return std::string(1, static_cast<char>('0' + input));
+        };
+        return aa::try_transform_reduce(inputs, std::string("0"), concatenate, digit).unwrap()
+            == "0123";
+    });
+
+    STATIC_TEST("Collect", {
+        std::array const inputs { 1, 2, 3 };
+        std::vector<int> values = aa::try_collect(inputs, parse).unwrap();
+        return values == std::vector { 2, 4, 6 };
+    });
+
+    STATIC_TEST("Collect values that are not trivially copyable", {
+        std::array const         inputs { 1, 0, 2 };
+        std::vector<std::string> strings = aa::try_collect(inputs, to_string).unwrap();
+        return strings.size() == 3 && strings[0] == "x" && strings[1].empty() && strings[2] == "xx";
+    });
+
+    STATIC_TEST("Collect stops at the first error", {
+        std::array const inputs { 1, -2, -3 };
+        return aa::try_collect(inputs, to_string).unwrap_err() == -2;
+    });
+
+} // namespace
@@ -0,0 +1,291 @@
+#include <aa/result.hpp>
+#include <cstdint>
+#include <string>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+    using namespace aa::tests;
+
+    struct Not_found {};
+    struct Unit {};
+
+    enum class Error_code : int { invalid_input = 1 };
+
+    STATIC_TEST("Union value construction", {
+        Result<Nontrivial, Nontrivial> const a { Nontrivial { 10 } };
+        return a.has_value() && a->integer == 10;
+    });
+
+    STATIC_TEST("Union error construction", {
+        Result<Nontrivial, Nontrivial> const a { Error { Nontrivial { 10 } } };
+        Result<Nontrivial, Nontrivial> const b { aa::in_place_error, 20 };
+        return a.is_error() && a.unwrap_err().integer == 10 && b.unwrap_err().integer == 20;
+    });
+
+    STATIC_TEST("Union copy and move assignment across alternatives", {
+        Result<Nontrivial, Nontrivial>       a { Nontrivial { 10 } };
+        Result<Nontrivial, Nontrivial> const b { aa::in_place_error, 20 };
+        a = b;
+        bool const copied = a.is_error() && a.unwrap_err().integer == 20;
+        a = Result<Nontrivial, Nontrivial> { Nontrivial { 30 } };
+        return copied && a.has_value() && a->integer == 30;
+    });
+
+    STATIC_TEST("Value niche", {
+        Result<Nontrivial_with_sentinel, Not_found> const a { Nontrivial { 10 } };
+        Result<Nontrivial_with_sentinel, Not_found> const b { Error { Not_found {} } };
+        return a.has_value() && a->integer == 10 && b.is_error()
+            && b.unwrap_unchecked() == Nontrivial_with_sentinel::sentinel;
+    });
+
+    STATIC_TEST("Value niche assignment across alternatives", {
+        Result<Nontrivial_with_sentinel, Not_found> a { Nontrivial { 10 } };
+        a = Result<Nontrivial_with_sentinel, Not_found> { Error { Not_found {} } };
+        bool const assigned_error = a.is_error();
+        a = Result<Nontrivial_with_sentinel, Not_found> { Nontrivial { 20 } };
+        return assigned_error && a.has_value() && a->integer == 20;
+    });
+
+    STATIC_TEST("Error niche", {
+        Result<Unit, Nontrivial_with_sentinel> const a {};
+        Result<Unit, Nontrivial_with_sentinel> const b { Error { Nontrivial_with_sentinel {
+            Nontrivial { 10 } } } };
+        return a.has_value() && b.is_error() && b.unwrap_err().integer == 10;
+    });
+
+    STATIC_TEST("Reference niche", {
+        int                              x = 10;
+        Result<aa::Ref<int>, Not_found>  a { x };
+        Result<aa::Ref<int>, Not_found>  b { Error { Not_found {} } };
+        Result<Unit, aa::Ref<int>> const c { Error { aa::Ref { x } } };
+        a.unwrap().get() = 20;
+        return x == 20 && b.is_error() && c.is_error() && c.unwrap_err().get() == 20;
+    });
+
+    STATIC_TEST("Reset", {
+        Result<Nontrivial, Nontrivial> a { aa::in_place_error, 10 };
+        a.reset();
+        return a.has_value() && a->integer == 0;
+    });
+
+    STATIC_TEST("map and map_err", {
+        Result<int, int> const a { 10 };
+        Result<int, int> const b { Error { 20 } };
+        return a.map([](int const x) { return x * 2; }).unwrap() == 20
+            && b.map_err([](int const x) { return x * 2; }).unwrap_err() == 40;
+    });
+
+    STATIC_TEST("map and map_err elide the result", {
+        int                    moves = 0;
+        Result<int, int> const a { 10 };
+        Result<int, int> const b { Error { 20 } };
+
+        auto const c = a.map([&moves](int) { return Move_counter { moves }; });
+        auto const d = b.map_err([&moves](int) { return Move_counter { moves }; });
+        auto const e = a.map([](int const x) { return Immovable { x }; });
+        auto const f = b.map_err([](int const x) { return Immovable { x }; });
+        return c.has_value() && d.is_error() && moves == 0 && e->integer == 10
+            && f.unwrap_err().integer == 20;
+    });
+
+    STATIC_TEST("val and err move the payload once", {
+        int                       moves = 0;
+        Result<Move_counter, int> a { aa::in_place, moves };
+        Result<int, Move_counter> b { aa::in_place_error, moves };
+
+        auto const c = std::move(a).val();
+        auto const d = std::move(b).err();
+        return c.has_value() && d.has_value() && moves == 2;
+    });
+
+    STATIC_TEST("emplace_with", {
+        int                       moves = 0;
+        Result<Move_counter, int> a { Error { 10 } };
+        Result<Immovable, int>    b { Error { 10 } };
+
+        // The functions do not throw, so no backup of the previous content is made.
+        a.emplace_with([&moves] noexcept { return Move_counter { moves }; });
+        b.emplace_with([](int const x) noexcept { return Immovable { x }; }, 20);
+        return a.has_value() && moves == 0 && b->integer == 20;
+    });
+
+    STATIC_TEST("Strong assignment keeps a backup of the previous alternative", {
+        using R = Result<Lifetime_counter, Lifetime_counter>;
+
+        int     moves        = 0;
+        int     destructions = 0;
+        R       a { aa::in_place, moves, destructions };
+        R const b { aa::in_place_error, moves, destructions };
+
+        // The copy may throw, so the value is moved into a backup before it is destroyed.
+        a = b;
+        return a.is_error() && moves == 1 && destructions == 2;
+    });
+
+    STATIC_TEST("Basic assignment constructs only the new alternative", {
+        using Sentinel = aa::Sentinel_config_default_for<Lifetime_counter>;
+        using R        = Result<
+                   Lifetime_counter,
+                   Lifetime_counter,
+                   aa::Access_config_checked,
+                   aa::Access_config_checked,
+                   Sentinel,
+                   Sentinel,
+                   aa::Assignment_config_basic>;
+
+        int     moves        = 0;
+        int     destructions = 0;
+        R       a { aa::in_place, moves, destructions };
+        R const b { aa::in_place_error, moves, destructions };
+
+        a = b;
+        return a.is_error() && moves == 0 && destructions == 1;
+    });
+
+    STATIC_TEST("Switching alternatives destroys the previous one", {
+        int                                    destructions = 0;
+        Result<Destruction_counter, int>       a { aa::in_place, destructions };
+        Result<Destruction_counter, int> const b { Error { 10 } };
+        a = b;
+        return a.is_error() && destructions == 1;
+    });
+
+    STATIC_TEST("Move assignment with a trivial value and a nontrivial error", {
+        Result<int, std::string> a { 10 };
+        a = Result<int, std::string> { Error { std::string { "invalid" } } };
+        return a.unwrap_err() == "invalid";
+    });
+
+    STATIC_TEST("Lazy pipeline", {
+        Result<int, int> const a { 10 };
+        Result<int, int> const b { Error { 20 } };
+
+        auto const twice    = [](int const x) { return x * 2; };
+        auto const positive = [](int const x) -> Result<int, int> {
+            if (x > 0) {
+                return x;
+            }
+            return Error { x };
+        };
+        auto const recover = [](int const x) { return Result<int, int> { x + 1 }; };
+
+        Result<int, long> const c
+            = b.lazy().map(twice).map_err([](int const x) { return long { x }; }).evaluate();
+
+        return a.lazy().map(twice).and_then(positive).value_or(0) == 20
+            && b.lazy().map(twice).or_else(recover).value_or(0) == 21
+            && a.lazy().map([](int const x) { return -x; }).and_then(positive).evaluate()
+                       .unwrap_err() == -10
+            && c.unwrap_err() == 20L;
+    });
+
+    STATIC_TEST("Lazy pipeline constructs no intermediate Result", {
+        int                       moves = 0;
+        Result<Move_counter, int> a { aa::in_place, moves };
+
+        auto const step = [](Move_counter&& counter) { return std::move(counter); };
+
+        int                       eager_moves = 0;
+        Result<Move_counter, int> c { aa::in_place, eager_moves };
+
+        // One move per step, like the eager chain. The last step constructs its result in place.
+        Result<Move_counter, int> const b
+            = std::move(a).lazy().map(step).map(step).map(step).evaluate();
+        Result<Move_counter, int> const d = std::move(c).map(step).map(step).map(step);
+        return b.has_value() && d.has_value() && moves == 3 && eager_moves == 3;
+    });
+
+    STATIC_TEST("Copy and move with trivial alternatives", {
+        Result<int, int> const a { 10 };
+        Result<int, int>       b { Error { 20 } };
+        Result<int, int> const c = a;
+        Result<int, int> const d = std::move(b);
+        return c.unwrap() == 10 && d.unwrap_err() == 20;
+    });
+
+    // Without a niche, the discriminant is stored in a separate flag.
+    static_assert(sizeof(Result<int, int>) == 2 * sizeof(int));
+    static_assert(sizeof(Result<aa::Ref<int>, aa::Ref<int>>) == 2 * sizeof(int*));
+
+    // When one alternative is stateless, the other's sentinel encodes the discriminant.
+    static_assert(sizeof(Result<aa::Ref<int>, Not_found>) == sizeof(int*));
+    static_assert(sizeof(Result<Unit, aa::Ref<int>>) == sizeof(int*));
+    static_assert(
+        sizeof(Result<Nontrivial_with_sentinel, Not_found>) == sizeof(Nontrivial_with_sentinel));
+
+    static_assert(std::is_trivially_copyable_v<Result<aa::Ref<int>, Not_found>>);
+    static_assert(!std::is_trivially_copyable_v<Result<std::string, int>>);
+    static_assert(std::is_nothrow_move_constructible_v<Result<std::string, int>>);
+    static_assert(std::is_trivially_copy_constructible_v<Result<int, int>>);
+    static_assert(std::is_trivially_move_constructible_v<Result<int, int>>);
+    static_assert(std::is_nothrow_move_assignable_v<Result<int, std::string>>);
+    static_assert(!std::is_trivially_copy_assignable_v<Result<Destruction_counter, int>>);
+
+    // Small results with trivial alternatives are trivially copyable, and returned in registers.
+    static_assert(std::is_trivially_copyable_v<Result<int, Error_code>>);
+    static_assert(std::is_trivially_copyable_v<Result<std::uint64_t, std::uint64_t>>);
+    static_assert(register_passable<Result<int, Error_code>>);
+    static_assert(register_passable<Result<double, Error_code>>);
+    static_assert(register_passable<Result<std::uint64_t, std::uint64_t>>);
+    static_assert(register_passable<Result<aa::Ref<int>, Not_found>>);
+    static_assert(register_passable<Result<aa::Ref<int>, Error_code>>);
+    static_assert(!register_passable<Result<std::string, Error_code>>);
+
+    // Derived results keep the configs of the result they come from.
+    struct Negative_sentinel final {
+        static constexpr auto sentinel_value() noexcept -> int
+        {
+            return -1;
+        }
+        static constexpr auto is_sentinel_value(int const value) noexcept -> bool
+        {
+            return value == -1;
+        }
+    };
+
+    using Basic = Result<
+        int,
+        int,
+        aa::Access_config_checked,
+        aa::Access_config_checked,
+        aa::Sentinel_config_default_for<int>,
+        aa::Sentinel_config_default_for<int>,
+        aa::Assignment_config_basic>;
+    using Niche = Result<
+        Unit,
+        int,
+        aa::Access_config_checked,
+        aa::Access_config_checked,
+        aa::Sentinel_config_default_for<Unit>,
+        Negative_sentinel>;
+
+    inline constexpr auto identity     = [](auto const& x) { return x; };
+    inline constexpr auto to_not_found = [](auto const&) { return Not_found {}; };
+
+    static_assert(sizeof(Niche) == sizeof(int));
+    static_assert(std::is_same_v<decltype(std::declval<Basic>().map(identity)), Basic>);
+    static_assert(std::is_same_v<decltype(std::declval<Basic>().map_err(identity)), Basic>);
+    static_assert(
+        std::is_same_v<decltype(std::declval<Basic>().lazy().map(identity).evaluate()), Basic>);
+    static_assert(std::is_same_v<
+                  decltype(std::declval<Basic&>().ref()),
+                  Result<
+                      aa::Ref<int>,
+                      aa::Ref<int>,
+                      aa::Access_config_checked,
+                      aa::Access_config_checked,
+                      aa::Sentinel_config_default_for<aa::Ref<int>>,
+                      aa::Sentinel_config_default_for<aa::Ref<int>>,
+                      aa::Assignment_config_basic>>);
+    static_assert(sizeof(decltype(std::declval<Niche>().map(to_not_found))) == sizeof(int));
+    static_assert(sizeof(decltype(std::declval<Niche>().lazy().map(to_not_found).evaluate()))
+                  == sizeof(int));
+    static_assert(sizeof(decltype(std::declval<Niche>().err())) == sizeof(int));
+
+    // `Result` is trivially relocatable if and only if both alternatives are.
+    static_assert(aa::trivially_relocatable<Result<Relocatable, int>>);
+    static_assert(!aa::trivially_relocatable<Result<Relocatable, Nontrivial>>);
+
+} // namespace
@@ -0,0 +1,62 @@
+#include <aa/result_batch.hpp>
+#include <string>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+    using namespace aa::tests;
+
+    STATIC_TEST("Values and errors are split into columns", {
+        Result_batch<Nontrivial, int> batch;
+        batch.push_value(10);
+        batch.push_error(1);
+        batch.push_value(20);
+        batch.push_value(30);
+        batch.push_error(2);
+        return batch.size() == 5 && batch.value_count() == 3 && batch.error_count() == 2
+            && batch.values()[0] == 10 && batch.values()[1] == 20 && batch.values()[2] == 30
+            && batch.errors()[0] == 1 && batch.errors()[1] == 2 && batch.error_rows()[0] == 1
+            && batch.error_rows()[1] == 4;
+    });
+
+    STATIC_TEST("Row access", {
+        Result_batch<Nontrivial, int> batch;
+        batch.push_error(1);
+        batch.push_value(10);
+        batch.push_error(2);
+        batch.push_value(20);
+        return batch[0].unwrap_err().get() == 1 && batch[1].unwrap()->integer == 10
+            && batch[2].unwrap_err().get() == 2 && batch[3].unwrap()->integer == 20
+            && batch.is_error(0) && !batch.is_error(1) && batch.is_error(2) && !batch.is_error(3);
+    });
+
+    STATIC_TEST("Mutation through row references", {
+        Result_batch<Nontrivial, int> batch;
+        batch.push_value(10);
+        batch[0].unwrap()->integer = 20;
+        return batch.values()[0] == 20;
+    });
+
+    STATIC_TEST("Clear", {
+        Result_batch<Nontrivial, int> batch;
+        batch.push_value(10);
+        batch.push_error(1);
+        batch.clear();
+        batch.push_value(20);
+        return batch.size() == 1 && !batch.is_error(0) && batch[0].unwrap()->integer == 20;
+    });
+
+    using Batch = Result_batch<std::string, int>;
+
+    static_assert(requires(Batch m, Batch const c) {
+        // clang-format off
+        { m[0] }       -> std::same_as<Result<aa::Ref<std::string>, aa::Ref<int>>>;
+        { c[0] }       -> std::same_as<Result<aa::Ref<std::string const>, aa::Ref<int const>>>;
+        { m.values() } -> std::same_as<std::span<std::string>>;
+        { c.values() } -> std::same_as<std::span<std::string const>>;
+        { c.errors() } -> std::same_as<std::span<int const>>;
+        // clang-format on
+    });
+
+} // namespace
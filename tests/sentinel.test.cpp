@@ -0,0 +1,82 @@
+#include <aa/sentinel.hpp>
+#include <aa/maybe.hpp>
+#include <string_view>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <span>
+#include "test_utility.hpp"
+
+namespace {
+
+    using aa::Access_config_checked;
+    using aa::Maybe;
+
+    template <class T, class Config>
+    using Maybe_with = Maybe<T, Access_config_checked, Access_config_checked, Config>;
+
+    STATIC_TEST("Null pointer sentinel", {
+        int                                             x = 10;
+        Maybe_with<int*, aa::Sentinel_null<int*>> const a { &x };
+        Maybe_with<int*, aa::Sentinel_null<int*>> const b;
+        return a.has_value() && *a.unwrap() == 10 && b.is_empty();
+    });
+
+    STATIC_TEST("Null unique_ptr sentinel", {
+        using Pointer = std::unique_ptr<int>;
+        Maybe_with<Pointer, aa::Sentinel_null<Pointer>> a { std::make_unique<int>(10) };
+        Maybe_with<Pointer, aa::Sentinel_null<Pointer>> b { std::move(a) };
+        bool const moved = a.is_empty() && b.has_value() && *b.unwrap() == 10;
+        b.reset();
+        return moved && b.is_empty();
+    });
+
+    STATIC_TEST("Null data sentinel", {
+        using View = std::string_view;
+        Maybe_with<View, aa::Sentinel_null_data<View>> const a { View { "" } };
+        Maybe_with<View, aa::Sentinel_null_data<View>> const b;
+        return a.has_value() && a.unwrap().empty() && b.is_empty();
+    });
+
+    STATIC_TEST("NaN sentinel", {
+        Maybe_with<double, aa::Sentinel_nan<double>> const a { 3.14 };
+        Maybe_with<double, aa::Sentinel_nan<double>> const b;
+        Maybe_with<double, aa::Sentinel_nan<double>> const c {
+            std::numeric_limits<double>::quiet_NaN()
+        };
+        return a.has_value() && b.is_empty() && c.has_value();
+    });
+
+    STATIC_TEST("Integer sentinel", {
+        Maybe_with<std::uint32_t, aa::Sentinel_int<std::uint32_t>> const a { 0U };
+        Maybe_with<std::uint32_t, aa::Sentinel_int<std::uint32_t>> const b;
+        Maybe_with<int, aa::Sentinel_int<int, -1>> const                 c { -1 };
+        return a.has_value() && b.is_empty() && c.is_empty();
+    });
+
+    static_assert(sizeof(Maybe_with<int*, aa::Sentinel_null<int*>>) == sizeof(int*));
+    static_assert(
+        sizeof(Maybe_with<std::unique_ptr<int>, aa::Sentinel_null<std::unique_ptr<int>>>)
+        == sizeof(std::unique_ptr<int>));
+    static_assert(
+        sizeof(Maybe_with<std::string_view, aa::Sentinel_null_data<std::string_view>>)
+        == sizeof(std::string_view));
+    static_assert(
+        sizeof(Maybe_with<std::span<int>, aa::Sentinel_null_data<std::span<int>>>)
+        == sizeof(std::span<int>));
+    static_assert(sizeof(Maybe_with<float, aa::Sentinel_nan<float>>) == sizeof(float));
+    static_assert(sizeof(Maybe_with<double, aa::Sentinel_nan<double>>) == sizeof(double));
+    static_assert(
+        sizeof(Maybe_with<std::uint32_t, aa::Sentinel_int<std::uint32_t>>)
+        == sizeof(std::uint32_t));
+
+    static_assert(std::is_trivially_copyable_v<Maybe_with<int*, aa::Sentinel_null<int*>>>);
+    static_assert(std::is_trivially_copyable_v<Maybe_with<double, aa::Sentinel_nan<double>>>);
+
+    template <class T>
+    concept has_null_data_config = requires { typename aa::Sentinel_null_data<T>; };
+
+    // Owning containers have a non-null data pointer even when empty, so they are rejected.
+    static_assert(has_null_data_config<std::string_view> && !has_null_data_config<std::string>);
+
+} // namespace
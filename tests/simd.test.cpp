@@ -0,0 +1,165 @@
+#include <aa/simd.hpp>
+#include <aa/sentinel.hpp>
+#include <cstdint>
+#include <vector>
+#include <array>
+#include <span>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+    using namespace aa::tests;
+
+    using Index = Maybe<
+        std::uint32_t,
+        aa::Access_config_checked,
+        aa::Access_config_checked,
+        aa::Sentinel_int<std::uint32_t>>;
+
+    STATIC_TEST("Flagged presence mask", {
+        std::array<Maybe<int>, 70> maybes {};
+        maybes[0]  = 1;
+        maybes[63] = 2;
+        maybes[69] = 3;
+        std::array<std::uint64_t, 2> mask {};
+        aa::simd::presence_mask(maybes, mask);
+        return mask[0] == ((std::uint64_t { 1 } << 63) | 1) && mask[1] == (1 << 5);
+    });
+
+    STATIC_TEST("Sentinel count_present", {
+        std::array<Index, 4> const maybes { 1U, nothing, 3U, nothing };
+        return aa::simd::count_present(maybes) == 2;
+    });
+
+    STATIC_TEST("Flagged compact_values", {
+        std::array<Maybe<int>, 5> const maybes { nothing, 1, nothing, 2, 3 };
+        std::array<int, 5>              output {};
+        return aa::simd::compact_values(maybes, output) == 3 && output[0] == 1 && output[1] == 2
+            && output[2] == 3;
+    });
+
+    STATIC_TEST("Sentinel fill_missing", {
+        std::array<Index, 3> maybes { nothing, 1U, nothing };
+        aa::simd::fill_missing(maybes, 7U);
+        return maybes[0].unwrap() == 7 && maybes[1].unwrap() == 1 && maybes[2].unwrap() == 7;
+    });
+
+    STATIC_TEST("Flagged fill_missing", {
+        std::array<Maybe<int>, 3> maybes { 1, nothing, 2 };
+        aa::simd::fill_missing(std::span { maybes }, 0);
+        return maybes[0].unwrap() == 1 && maybes[1].unwrap() == 0 && maybes[2].unwrap() == 2;
+    });
+
+    using aa::simd::dtl::Isa;
+
+    template <class T>
+    using Sentinel
+        = Maybe<T, aa::Access_config_checked, aa::Access_config_checked, aa::Sentinel_int<T>>;
+
+    template <class M>
+    using Value = typename aa::simd::dtl::Layout_traits<M>::Value;
+
+    // Irregular, so that every vector and every tail holds a different mix of present and absent.
+    [[nodiscard]] constexpr auto is_present(std::size_t const index) noexcept -> bool
+    {
+        return (index * index + index / 7) % 5 >= 2;
+    }
+
+    template <class M>
+    [[nodiscard]] constexpr auto value_at(std::size_t const index) noexcept -> Value<M>
+    {
+        return static_cast<Value<M>>(index % 100);
+    }
+
+    // Runs the kernels for `isa`, or for the best supported one below it, on `count` elements,
+    // and compares what they compute with a loop over the elements. The elements are allocated
+    // exactly, so that a sanitizer catches a kernel that reads past the end.
+    template <class M>
+    auto kernels_agree(Isa const isa, std::size_t const count) -> bool
+    {
+        using Traits = aa::simd::dtl::Layout_traits<M>;
+
+        std::vector<M>             maybes(count);
+        std::vector<std::uint64_t> expected_mask((count + 63) / 64);
+        std::vector<Value<M>>      expected_values;
+        for (std::size_t index = 0; index != count; ++index) {
+            if (is_present(index)) {
+                maybes[index].emplace(value_at<M>(index));
+                expected_mask[index / 64] |= std::uint64_t { 1 } << (index % 64);
+                expected_values.push_back(value_at<M>(index));
+            }
+        }
+
+        // The layout is read from the first element, so an empty range borrows one.
+        std::vector<M> const      placeholder(1);
+        std::span<M const> const  elements { count == 0 ? placeholder : maybes };
+        aa::simd::dtl::Key_layout layout = Traits::layout(elements);
+        layout.count = count;
+
+        auto const&                kernels = aa::simd::dtl::kernels_for(isa);
+        std::vector<std::uint64_t> mask(expected_mask.size());
+        kernels.presence_mask(layout, mask.data());
+        if (mask != expected_mask || kernels.count_present(layout) != expected_values.size()) {
+            return false;
+        }
+
+        if constexpr (Traits::bitwise) {
+            std::vector<Value<M>> values(expected_values.size());
+            if (kernels.compact_keys(layout, reinterpret_cast<std::byte*>(values.data()))
+                    != values.size()
+                || values != expected_values) {
+                return false;
+            }
+            Value<M> const fallback = 7;
+            kernels.replace_absent(
+                reinterpret_cast<std::byte*>(maybes.data()),
+                sizeof(Value<M>),
+                count,
+                layout.absent,
+                aa::simd::dtl::key_bits(fallback));
+            for (std::size_t index = 0; index != count; ++index) {
+                if (maybes[index].unwrap() != (is_present(index) ? value_at<M>(index) : fallback)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    template <class... Ms>
+    auto all_kernels_agree() -> bool
+    {
+        for (Isa const isa : { Isa::scalar, Isa::sse42, Isa::avx2 }) {
+            for (std::size_t const count : { 0, 1, 63, 64, 65, 1000 }) {
+                if (!(kernels_agree<Ms>(isa, count) && ...)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // The flag of `Maybe<std::uint8_t>` is one byte after the next, which is the shortest stride
+    // of the gather, and has the longest tail that it must leave to the scalar loop.
+    RUNTIME_TEST("Flagged kernels agree with a loop", {
+        return all_kernels_agree<Maybe<int>, Maybe<std::uint8_t>, Maybe<Nontrivial>>();
+    });
+
+    RUNTIME_TEST("Sentinel kernels agree with a loop", {
+        return all_kernels_agree<
+            Sentinel<std::uint8_t>,
+            Sentinel<std::uint16_t>,
+            Sentinel<std::uint32_t>,
+            Sentinel<std::uint64_t>>();
+    });
+
+    static_assert(aa::simd::batchable<Maybe<int>>);
+    static_assert(aa::simd::batchable<Maybe<Nontrivial>>);
+    static_assert(aa::simd::batchable<Index>);
+    static_assert(aa::simd::batchable<Maybe<aa::Ref<int>>>);
+
+    // The sentinel config of `Nontrivial_with_sentinel` does not promise a bitwise comparison.
+    static_assert(!aa::simd::batchable<Maybe<Nontrivial_with_sentinel>>);
+
+} // namespace
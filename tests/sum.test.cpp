@@ -0,0 +1,147 @@
+#include <aa/sum.hpp>
+#include <aa/maybe.hpp>
+#include <aa/box.hpp>
+#include <cstdint>
+#include <string>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+
+    template <std::size_t index>
+    struct Alternative {
+        int value {};
+    };
+
+    template <std::size_t... indices>
+    auto make_sum(std::index_sequence<indices...>) -> Sum<Alternative<indices>...>;
+
+    template <std::size_t count>
+    using Sum_of = decltype(make_sum(std::make_index_sequence<count> {}));
+
+    struct Move_only {
+        int value {};
+
+        explicit constexpr Move_only(int const value) noexcept : value { value } {}
+
+        Move_only(Move_only const&)                    = delete;
+        Move_only(Move_only&&)                         = default;
+        auto operator=(Move_only const&) -> Move_only& = delete;
+        auto operator=(Move_only&&) -> Move_only&      = default;
+    };
+
+    template <class S, class T>
+    concept has_alternative = requires(S sum) { sum.template holds<T>(); };
+
+    // The index is as small as the number of alternatives allows.
+    static_assert(sizeof(Sum<std::uint8_t, char>) == 2);
+    static_assert(sizeof(Sum<int, float, double>) == 16);
+    static_assert(sizeof(Sum_of<32>) == 8);
+    static_assert(sizeof(Sum_of<256>) == 8);
+    static_assert(sizeof(Sum_of<257>) == 8);
+
+    static_assert(std::is_trivially_copyable_v<Sum<int, float, double>>);
+    static_assert(std::is_trivially_destructible_v<Sum<int, Ref<int>>>);
+    static_assert(!std::is_trivially_copyable_v<Sum<int, std::string>>);
+    static_assert(!std::is_copy_constructible_v<Sum<int, Move_only>>);
+    static_assert(std::is_nothrow_move_constructible_v<Sum<int, Move_only, std::string>>);
+    static_assert(aa::Trivially_relocatable<Sum<int, Box<int>>>::value);
+
+    static_assert(has_alternative<Sum<int, float>, float>);
+    static_assert(!has_alternative<Sum<int, float>, double>);
+
+    // Every alternative is a distinct type.
+    template <class... Ts>
+    concept valid_sum = requires { typename Sum<Ts...>; };
+    static_assert(valid_sum<int, float>);
+    static_assert(!valid_sum<int, float, int>);
+    static_assert(!valid_sum<>);
+
+    STATIC_TEST("Construction selects the alternative", {
+        Sum<int, std::string, double> const a;
+        Sum<int, std::string, double> const b { std::string("hello") };
+        Sum<int, std::string, double> const c { aa::in_place_index<2>, 2.5 };
+        Sum<int, std::string, double> const d { aa::in_place_type<std::string>, 3, 'x' };
+        return a.index() == 0 && a.unwrap<0>() == 0 && b.holds<std::string>()
+            && b.unwrap<std::string>() == "hello" && c.unwrap<2>() == 2.5
+            && d.unwrap<1>() == "xxx";
+    });
+
+    STATIC_TEST("Copy and move", {
+        Sum<int, std::string> a { std::string("hello") };
+        Sum<int, std::string> b = a;
+        Sum<int, std::string> c = std::move(a);
+        return b.unwrap<1>() == "hello" && c.unwrap<1>() == "hello";
+    });
+
+    STATIC_TEST("Assignment switches alternatives", {
+        Sum<int, std::string> a { 10 };
+        Sum<int, std::string> b { std::string("hello") };
+        a = b;
+        bool const copied = a.unwrap<1>() == "hello";
+        b = Sum<int, std::string> { 20 };
+        a = std::move(b);
+        return copied && a.unwrap<0>() == 20;
+    });
+
+    STATIC_TEST("Emplace replaces the alternative", {
+        Sum<int, std::string, Move_only> sum { std::string("hello") };
+        sum.emplace<Move_only>(5);
+        bool const first = sum.index() == 2 && sum.unwrap<2>().value == 5;
+        sum.emplace<1>(2, 'y');
+        return first && sum.unwrap<std::string>() == "yy";
+    });
+
+    STATIC_TEST("Try get", {
+        Sum<int, std::string> sum { std::string("hello") };
+        sum.try_get<std::string>().unwrap().get() += " world";
+        return sum.try_get<0>().is_empty() && sum.unwrap<1>() == "hello world";
+    });
+
+    STATIC_TEST("Visit", {
+        Sum<int, std::string, Move_only> const sum { Move_only { 7 } };
+        auto const visitor = [](auto const& alternative) -> int {
+            using T = std::remove_cvref_t<decltype(alternative)>;
+            if constexpr (std::is_same_v<T, int>) {
+                return alternative;
+            }
+            else if constexpr (std::is_same_v<T, std::string>) {
+                return static_cast<int>(alternative.size());
+            }
+            else {
+                return alternative.value;
+            }
+        };
+        return sum.visit(visitor) == 7;
+    });
+
+    STATIC_TEST("Visit more alternatives than one switch covers", {
+        Sum_of<40> const sum { aa::in_place_index<37>, Alternative<37> { 7 } };
+        return sum.index() == 37 && sum.visit([](auto const& alternative) {
+            return alternative.value;
+        }) == 7;
+    });
+
+    // More alternatives than a compiler allows operands in a fold.
+    STATIC_TEST("Visit more alternatives than a fold allows", {
+        Sum_of<300> const sum { aa::in_place_index<299>, Alternative<299> { 7 } };
+        return sum.index() == 299 && sum.visit([](auto const& alternative) {
+            return alternative.value;
+        }) == 7;
+    });
+
+    STATIC_TEST("Visit forwards the value category", {
+        Sum<int, std::string> sum { std::string("hello") };
+        std::string const moved = std::move(sum).visit([](auto&& alternative) -> std::string {
+            if constexpr (std::is_same_v<decltype(alternative), std::string&&>) {
+                return std::move(alternative);
+            }
+            else {
+                return "";
+            }
+        });
+        return moved == "hello";
+    });
+
+} // namespace
@@ -1 +1,37 @@
-auto main() -> int {}
+#include <exception>
+#include <cstdlib>
+#include <cstdio>
+#include "test_utility.hpp"
+
+auto aa::tests::runtime_tests() -> std::vector<Runtime_test>&
+{
+    static std::vector<Runtime_test> tests;
+    return tests;
+}
+
+// Static tests have passed if this compiled. Runs the runtime tests, and reports those that fail.
+auto main() -> int
+{
+    int failures = 0;
+    for (aa::tests::Runtime_test const& test : aa::tests::runtime_tests()) {
+        bool passed = false;
+        try {
+            passed = test.function();
+        }
+        catch (std::exception const& exception) {
+            std::fprintf(stderr, "Exception: %s\n", exception.what());
+        }
+        catch (...) {
+            std::fputs("Unknown exception\n", stderr);
+        }
+        if (!passed) {
+            std::fprintf(
+                stderr,
+                "Failed: %.*s\n",
+                static_cast<int>(test.name.size()),
+                test.name.data());
+            ++failures;
+        }
+    }
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,11 +1,44 @@
 #pragma once
 
 #include <aa/maybe.hpp>
+#include <string_view>
+#include <vector>
 
 #define STATIC_TEST(name, ...) static_assert(([] consteval -> bool __VA_ARGS__)(), name);
 
+// For what cannot be evaluated at compile time. Runs when the test executable runs.
+#define RUNTIME_TEST(name, ...) RUNTIME_TEST_AT(__LINE__, name, __VA_ARGS__)
+#define RUNTIME_TEST_AT(line, name, ...) RUNTIME_TEST_REGISTRATION(line, name, __VA_ARGS__)
+#define RUNTIME_TEST_REGISTRATION(line, name, ...)                            \
+    static ::aa::tests::Runtime_test_registration const runtime_test_##line { \
+        name, [] -> bool __VA_ARGS__                                          \
+    };
+
 namespace aa::tests {
 
+    using Runtime_test_function = auto (*)() -> bool;
+
+    struct Runtime_test {
+        std::string_view      name;
+        Runtime_test_function function {};
+    };
+
+    // All registered runtime tests, in registration order.
+    auto runtime_tests() -> std::vector<Runtime_test>&;
+
+    struct Runtime_test_registration {
+        Runtime_test_registration(std::string_view const name, Runtime_test_function const function)
+        {
+            runtime_tests().push_back(Runtime_test { name, function });
+        }
+    };
+
+    // What the x86-64 System V ABI requires to pass and return an object in registers.
+    template <class T>
+    concept register_passable = std::is_trivially_copy_constructible_v<T>
+                             && std::is_trivially_move_constructible_v<T>
+                             && std::is_trivially_destructible_v<T> && sizeof(T) <= 16;
+
     struct Nontrivial {
         int integer {};
 
@@ -55,8 +88,103 @@ namespace aa::tests {
         && !std::is_trivially_move_constructible_v<Nontrivial>
         && !std::is_trivially_destructible_v<Nontrivial>);
 
+    // Not trivially copyable, but opts in to trivial relocation.
+    struct Relocatable : Nontrivial {};
+
     static_assert(aa::sane<Nontrivial> && aa::sane<Nontrivial_with_sentinel>);
 
+    // Counts how many times it has been moved, in the counter that it was constructed with.
+    struct Move_counter {
+        int* moves {};
+
+        explicit constexpr Move_counter(int& counter) noexcept : moves(&counter) {}
+
+        constexpr Move_counter(Move_counter&& other) noexcept : moves(other.moves)
+        {
+            ++*moves;
+        }
+    };
+
+    static_assert(aa::sane<Move_counter>);
+
+    // Counts moves and destructions in the counters that it was constructed with. Copies may
+    // throw, so replacing a copy takes the slow path of the assignment configs.
+    struct Lifetime_counter {
+        int* moves {};
+        int* destructions {};
+
+        Lifetime_counter() = default;
+
+        constexpr Lifetime_counter(int& move_counter, int& destruction_counter) noexcept
+            : moves(&move_counter)
+            , destructions(&destruction_counter)
+        {}
+
+        constexpr Lifetime_counter(Lifetime_counter const& other) noexcept(false)
+            : moves(other.moves)
+            , destructions(other.destructions)
+        {}
+
+        constexpr Lifetime_counter(Lifetime_counter&& other) noexcept
+            : moves(other.moves)
+            , destructions(other.destructions)
+        {
+            ++*moves;
+        }
+
+        constexpr auto operator=(Lifetime_counter const& other) noexcept(false) -> Lifetime_counter&
+        {
+            moves        = other.moves;
+            destructions = other.destructions;
+            return *this;
+        }
+
+        constexpr auto operator=(Lifetime_counter&& other) noexcept -> Lifetime_counter&
+        {
+            moves        = other.moves;
+            destructions = other.destructions;
+            ++*moves;
+            return *this;
+        }
+
+        constexpr ~Lifetime_counter()
+        {
+            if (destructions != nullptr) {
+                ++*destructions;
+            }
+        }
+    };
+
+    static_assert(aa::sane<Lifetime_counter>);
+
+    // Trivially copy-assignable, but counts its destructions in the counter that it was
+    // constructed with, so an assignment that replaces it must not be trivial.
+    struct Destruction_counter {
+        int* destructions {};
+
+        explicit constexpr Destruction_counter(int& counter) noexcept : destructions(&counter) {}
+
+        Destruction_counter(Destruction_counter const&)                    = default;
+        auto operator=(Destruction_counter const&) -> Destruction_counter& = default;
+
+        constexpr ~Destruction_counter()
+        {
+            ++*destructions;
+        }
+    };
+
+    static_assert(aa::sane<Destruction_counter>);
+
+    struct Immovable {
+        int integer {};
+
+        explicit constexpr Immovable(int const value) noexcept : integer(value) {}
+
+        Immovable(Immovable&&) = delete;
+    };
+
+    static_assert(aa::sane<Immovable>);
+
 } // namespace aa::tests
 
 template <>
@@ -72,3 +200,6 @@ struct aa::Sentinel_config_default_for<aa::tests::Nontrivial_with_sentinel> fina
         return x.integer == aa::tests::Nontrivial_with_sentinel::sentinel;
     }
 };
+
+template <>
+struct aa::Trivially_relocatable<aa::tests::Relocatable> : std::true_type {};
@@ -1,4 +1,5 @@
 #include <aa/utility.hpp>
+#include "test_utility.hpp"
 
 static_assert(std::is_same_v<aa::Qualified_like<int&, float>, float&>);
 static_assert(std::is_same_v<aa::Qualified_like<int&, float&>, float&>);
@@ -33,4 +34,46 @@ static_assert(!std::is_convertible_v<aa::Ref<int const>, aa::Ref<int>>);
 
 static_assert(aa::access_config<aa::Access_config_checked>);
 static_assert(aa::access_config<aa::Access_config_unchecked>);
+static_assert(aa::access_config<aa::Access_config_assume>);
+static_assert(aa::access_config<aa::Access_config_trap>);
+static_assert(!noexcept(aa::Access_config_checked::validate_access(true)));
+static_assert(noexcept(aa::Access_config_assume::validate_access(true)));
+static_assert(noexcept(aa::Access_config_trap::validate_access(true)));
 static_assert(aa::sentinel_config<aa::Sentinel_config_default_for<int>, int>);
+
+static_assert(aa::trivially_relocatable<int>);
+static_assert(aa::trivially_relocatable<aa::Ref<int>>);
+static_assert(aa::trivially_relocatable<aa::tests::Relocatable>);
+static_assert(!aa::trivially_relocatable<aa::tests::Nontrivial>);
+
+namespace {
+
+    using aa::tests::Nontrivial;
+
+    STATIC_TEST("relocate_n closes the gap of an erased element", {
+        std::allocator<Nontrivial> allocator;
+        Nontrivial* const          data = allocator.allocate(3);
+        for (int index = 0; index != 3; ++index) {
+            std::construct_at(data + index, index);
+        }
+        std::destroy_at(data);
+        Nontrivial* const end       = aa::relocate_n(data + 1, 2, data);
+        bool const        relocated = end == data + 2 && data[0] == 1 && data[1] == 2;
+        std::destroy(data, end);
+        allocator.deallocate(data, 3);
+        return relocated;
+    });
+
+    STATIC_TEST("grow_storage relocates into new storage", {
+        std::allocator<Nontrivial> allocator;
+        Nontrivial*                data = allocator.allocate(2);
+        std::construct_at(data, 10);
+        std::construct_at(data + 1, 20);
+        data                 = aa::grow_storage(allocator, data, 2, 2, 4);
+        bool const relocated = data[0] == 10 && data[1] == 20;
+        std::destroy_n(data, 2);
+        allocator.deallocate(data, 4);
+        return relocated;
+    });
+
+} // namespace
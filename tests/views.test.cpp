@@ -0,0 +1,110 @@
+#include <aa/views.hpp>
+#include <aa/result.hpp>
+#include <aa/maybe.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <array>
+#include "test_utility.hpp"
+
+namespace {
+
+    using namespace aa::basics;
+
+    constexpr auto parse(int const input) -> Result<int, int>
+    {
+        if (input < 0) {
+            return Error { -input };
+        }
+        return input * 10;
+    }
+
+    constexpr auto halve(int const input) -> Maybe<int>
+    {
+        if (input % 2 != 0) {
+            return nothing;
+        }
+        return input / 2;
+    }
+
+    template <std::ranges::range R>
+    constexpr auto to_vector(R&& range) -> std::vector<std::ranges::range_value_t<R>>
+    {
+        std::vector<std::ranges::range_value_t<R>> vector;
+        for (auto&& element : range) {
+            vector.push_back(element);
+        }
+        return vector;
+    }
+
+    static_assert(std::ranges::input_range<decltype(
+                      std::declval<std::vector<int>&>() | aa::views::filter_map(halve))>);
+    static_assert(std::ranges::view<decltype(
+                      std::declval<std::vector<int>&>() | aa::views::filter_map(halve))>);
+
+    // Lvalue elements are viewed by reference.
+    static_assert(std::is_same_v<
+                  std::ranges::range_reference_t<decltype(
+                      std::declval<std::vector<Result<int, int>>&>() | aa::views::values)>,
+                  int&>);
+    static_assert(std::is_same_v<
+                  std::ranges::range_reference_t<decltype(
+                      std::declval<std::vector<Maybe<int>> const&>() | aa::views::present)>,
+                  int const&>);
+
+    // Only `values` and `errors` apply to `Result`, and only `present` to `Maybe`.
+    template <class R, class View>
+    concept viewable_with = requires(R range, View view) { range | view; };
+    static_assert(!viewable_with<std::vector<Maybe<int>>&, decltype(aa::views::values)>);
+    static_assert(!viewable_with<std::vector<Result<int, int>>&, decltype(aa::views::present)>);
+
+    STATIC_TEST("Maybe composes with std::views::join", {
+        std::vector<Maybe<int>> const maybes { 1, nothing, 2, nothing, 3 };
+        return to_vector(maybes | std::views::join) == std::vector { 1, 2, 3 };
+    });
+
+    STATIC_TEST("Values and errors", {
+        std::vector<Result<int, int>> const results { parse(1), parse(-2), parse(3), parse(-4) };
+        return to_vector(results | aa::views::values) == std::vector { 10, 30 }
+            && to_vector(results | aa::views::errors) == std::vector { 2, 4 };
+    });
+
+    STATIC_TEST("Values of prvalue results", {
+        std::array const inputs { 1, -2, 3 };
+        auto             values = inputs | std::views::transform(parse) | aa::views::values;
+        return to_vector(values) == std::vector { 10, 30 };
+    });
+
+    STATIC_TEST("Present values can be modified in place", {
+        std::vector<Maybe<std::string>> maybes { "a", nothing, "b" };
+        for (std::string& value : maybes | aa::views::present) {
+            value += "!";
+        }
+        return maybes[0].unwrap() == "a!" && maybes[1].is_empty() && maybes[2].unwrap() == "b!";
+    });
+
+    STATIC_TEST("Filter map", {
+        std::array const inputs { 1, 2, 3, 4, 6 };
+        return to_vector(inputs | aa::views::filter_map(halve)) == std::vector { 1, 2, 3 }
+            && to_vector(aa::views::filter_map(inputs, halve)) == std::vector { 1, 2, 3 };
+    });
+
+    STATIC_TEST("Filter map calls the function once per element", {
+        std::array const inputs { 1, 2, 3, 4 };
+        int              calls = 0;
+        auto const       counted_halve = [&](int const input) {
+            ++calls;
+            return halve(input);
+        };
+        auto const halves = to_vector(inputs | aa::views::filter_map(counted_halve));
+        return calls == 4 && halves == std::vector { 1, 2 };
+    });
+
+    STATIC_TEST("Filter map composes with std::views", {
+        std::array const inputs { 1, 2, 3, 4, 6, 8 };
+        auto             view = inputs | std::views::transform([](int const x) { return x * 3; })
+                  | aa::views::filter_map(halve) | std::views::take(2);
+        return to_vector(view) == std::vector { 3, 6 };
+    });
+
+} // namespace